@@ -42,6 +42,10 @@ auto main(
             },
         .extensions = {},
         .max_fixed_update_duration = 10ms,
+        // Simulate the next frame while the current one is being rendered.
+        .pipeline_depth = 1,
+        .target_fps = 60.0F,
+        .stats_log_interval = 10s,
     };
 
     engine = std::make_shared<Engine>(*platform, props);
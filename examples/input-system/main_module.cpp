@@ -6,7 +6,6 @@
 
 #include "main_module.h"
 
-#include <random>
 #include <stdexcept>
 
 #include "oxygen/base/compilers.h"
@@ -23,6 +22,7 @@ OXYGEN_DIAGNOSTIC_POP
 #include "SDL3/SDL.h"
 
 #include "oxygen/core/engine.h"
+#include "oxygen/core/system_scheduler.h"
 #include "oxygen/input/action.h"
 #include "oxygen/input/action_triggers.h"
 #include "oxygen/input/input_action_mapping.h"
@@ -146,6 +146,10 @@ void MainModule::Initialize() {
   // Now the player is moving on the ground
   player_input_->ActivateMappingContext(modifier_keys);
   player_input_->ActivateMappingContext(ground_movement);
+
+  // The engine updates the input system every frame, after the input events
+  // have been dispatched.
+  engine_.AddSystem(player_input_, {.name = "PlayerInput"});
 }
 
 void MainModule::ProcessInput(const oxygen::platform::InputEvent &event) {
@@ -153,14 +157,20 @@ void MainModule::ProcessInput(const oxygen::platform::InputEvent &event) {
   player_input_->ProcessInput(event);
 }
 
-void MainModule::Update(oxygen::Duration delta_time) {
-  const oxygen::engine::SystemUpdateContext updateContext(
-      oxygen::Duration::zero(), delta_time);
-  player_input_->Update(updateContext);
+void MainModule::Update(
+    oxygen::Duration /*delta_time*/, const float fixed_alpha) {
+  fixed_alpha_ = fixed_alpha;
 }
 
 namespace {
 
+// Everything needed to render a frame, in pipelined mode.
+struct RenderPacket final : oxygen::core::FramePacket {
+  explicit RenderPacket(const float distance) : distance(distance) {
+  }
+  float distance;
+};
+
 auto CheckLimits(float &direction, float &new_distance) -> void {
   if (new_distance >= 320.0F) {
     new_distance = 320.0F;
@@ -175,27 +185,39 @@ auto CheckLimits(float &direction, float &new_distance) -> void {
 } // namespace
 
 void MainModule::FixedUpdate() {
+  state_.previous_distance = state_.distance;
   auto new_distance = state_.distance + state_.direction * 2.0F;
   CheckLimits(state_.direction, new_distance);
   state_.distance = new_distance;
 }
 
+auto MainModule::InterpolatedDistance() const -> float {
+  return state_.previous_distance +
+         (state_.distance - state_.previous_distance) * fixed_alpha_;
+}
+
 void MainModule::Render() {
-  // Create a random number core.
-  static std::random_device rd;
-  static std::mt19937 gen(rd());
-  static std::uniform_int_distribution<> distribution(60, 90);
+  Draw(InterpolatedDistance());
+}
 
+auto MainModule::PublishFramePacket()
+    -> std::unique_ptr<const oxygen::core::FramePacket> {
+  return std::make_unique<const RenderPacket>(InterpolatedDistance());
+}
+
+void MainModule::RenderFramePacket(const oxygen::core::FramePacket &packet) {
+  Draw(static_cast<const RenderPacket &>(packet).distance);
+}
+
+void MainModule::Draw(const float distance) {
   SDL_SetRenderDrawColor(renderer_, 0, 0, 0, 255);
   SDL_RenderClear(renderer_);
   SDL_SetRenderDrawColor(renderer_, 255, 255, 255, 255);
-  const SDL_FRect rect = {320 - state_.distance, 320 - state_.distance,
-      2 * state_.distance, 2 * state_.distance};
+  const SDL_FRect rect = {
+      320 - distance, 320 - distance, 2 * distance, 2 * distance};
   SDL_RenderFillRect(renderer_, &rect);
 
   SDL_RenderPresent(renderer_);
-
-  std::this_thread::sleep_for(std::chrono::milliseconds(distribution(gen)));
 }
 
 void MainModule::Shutdown() noexcept {
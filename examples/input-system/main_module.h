@@ -34,18 +34,27 @@ public:
   void Initialize() override;
 
   void ProcessInput(const oxygen::platform::InputEvent &event) override;
-  void Update(oxygen::Duration delta_time) override;
+  void Update(oxygen::Duration delta_time, float fixed_alpha) override;
   void FixedUpdate() override;
   void Render() override;
+  auto PublishFramePacket()
+      -> std::unique_ptr<const oxygen::core::FramePacket> override;
+  void RenderFramePacket(const oxygen::core::FramePacket &packet) override;
 
   void Shutdown() noexcept override;
 
 private:
   struct State {
     float distance{10.0F};
+    float previous_distance{10.0F};
     float direction{1.0F};
   };
   State state_;
+  float fixed_alpha_{0.0F};
+
+  [[nodiscard]] auto InterpolatedDistance() const -> float;
+
+  void Draw(float distance);
 
   oxygen::Engine &engine_;
   SDL_Renderer *renderer_{nullptr};
@@ -49,8 +49,7 @@ auto main(
     while (continue_running) {
       if (const auto event = platform->PollEvent()) {
         if (event->GetType() == oxygen::platform::InputEventType::kKeyEvent) {
-          const auto &key_event =
-              dynamic_cast<const oxygen::platform::KeyEvent &>(*event);
+          const auto &key_event = event->As<oxygen::platform::KeyEvent>();
           if (key_event.GetButtonState() ==
               oxygen::platform::ButtonState::kPressed) {
 
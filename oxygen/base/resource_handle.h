@@ -107,6 +107,10 @@ public:
 
   [[nodiscard]] constexpr auto Handle() const -> HandleT;
 
+  // Overwrite all fields at once with the raw value obtained from `Handle()`,
+  // typically when restoring handles that were serialized.
+  constexpr void SetHandle(HandleT handle);
+
   [[nodiscard]] constexpr auto IsValid() const -> bool;
 
   constexpr void Invalidate();
@@ -204,6 +208,10 @@ constexpr auto ResourceHandle::Handle() const -> HandleT {
   return handle_;
 }
 
+constexpr void ResourceHandle::SetHandle(const HandleT handle) {
+  handle_ = handle;
+}
+
 constexpr auto ResourceHandle::Index() const -> IndexT {
   return handle_ & kIndexMask;
 }
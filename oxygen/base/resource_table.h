@@ -128,6 +128,42 @@ class ResourceTable
    */
   [[nodiscard]] auto Items() const -> std::span<const T> { return items_; }
 
+  // -- Bulk access ------------------------------------------------------------
+
+  /*
+  Raw views of the internal sets, used to save the table as contiguous columns.
+  Together with the freelist bounds, they fully describe the state of the table,
+  including the generations of the free slots. A table restored from them hands
+  out exactly the same handles as the original one.
+  */
+  [[nodiscard]] auto SparseItems() const -> std::span<const ResourceHandle>
+  {
+    return sparse_table_;
+  }
+  [[nodiscard]] auto MetaItems() const -> std::span<const Meta>
+  {
+    return meta_;
+  }
+  [[nodiscard]] auto FreeListFront() const noexcept { return freelist_front_; }
+  [[nodiscard]] auto FreeListBack() const noexcept { return freelist_back_; }
+
+  /*
+  Replaces the content of the table with sets previously obtained through the
+  bulk access methods. The sparse set is given as raw handle values (see
+  `ResourceHandle::Handle()`), so that it can be adopted directly from a file
+  mapped in memory. The dense and meta sets are copied in bulk.
+
+  Handles obtained from the table that produced the sets are valid for the
+  restored table. Returns `false`, leaving the table empty, if the sets are not
+  consistent with each other.
+  */
+  auto Restore(
+      std::span<const ResourceHandle::HandleT> sparse,
+      std::span<const Meta> meta,
+      std::span<const T> items,
+      ResourceHandle::IndexT freelist_front,
+      ResourceHandle::IndexT freelist_back) -> bool;
+
   // -- Capacity ---------------------------------------------------------------
 
   [[nodiscard]] auto Size() const noexcept { return items_.size(); }
@@ -446,6 +482,87 @@ void ResourceTable<T>::Reset() noexcept
   sparse_table_.clear();
 }
 
+template <typename T>
+auto ResourceTable<T>::Restore(
+    std::span<const ResourceHandle::HandleT> sparse,
+    std::span<const Meta> meta,
+    std::span<const T> items,
+    const ResourceHandle::IndexT freelist_front,
+    const ResourceHandle::IndexT freelist_back) -> bool
+{
+  Reset();
+
+  const auto is_sparse_index = [&sparse](const ResourceHandle::IndexT index) {
+    return index < sparse.size();
+  };
+  if (meta.size() != items.size() || items.size() > sparse.size() ||
+      (freelist_front != ResourceHandle::kIndexMax &&
+       (!is_sparse_index(freelist_front) || !is_sparse_index(freelist_back)))) {
+    return false;
+  }
+
+  // Each item must be referred to by exactly one handle in use, and the
+  // freelist must chain all the free handles, so that later insertions never
+  // index out of the sparse set or reuse a handle in use.
+  std::vector<bool> dense_used(items.size(), false);
+  size_t free_count = 0;
+  sparse_table_.resize(sparse.size());
+  for (size_t index = 0; index < sparse.size(); ++index) {
+    auto& handle = sparse_table_[index];
+    handle.SetHandle(sparse[index]);
+    if (handle.ResourceType() != item_type_) {
+      Reset();
+      return false;
+    }
+    if (handle.IsFree()) {
+      ++free_count;
+      continue;
+    }
+    const auto dense_index = handle.Index();
+    if (dense_index >= items.size() || dense_used[dense_index] ||
+        meta[dense_index].dense_to_sparse != index) {
+      Reset();
+      return false;
+    }
+    dense_used[dense_index] = true;
+  }
+
+  if (sparse.size() - free_count != items.size()) {
+    Reset();
+    return false;
+  }
+
+  size_t chained = 0;
+  for (auto index = freelist_front; index != ResourceHandle::kIndexMax;) {
+    // Bounding the walk to the number of free handles also rejects cycles.
+    if (!is_sparse_index(index) || chained == free_count ||
+        !sparse_table_[index].IsFree()) {
+      Reset();
+      return false;
+    }
+    ++chained;
+    const auto next = sparse_table_[index].Index();
+    if ((next == ResourceHandle::kIndexMax) != (index == freelist_back)) {
+      Reset();
+      return false;
+    }
+    index = next;
+  }
+  if (chained != free_count) {
+    Reset();
+    return false;
+  }
+
+  // Both are contiguous ranges, which lets the standard library use a plain
+  // memory copy when T is trivially copyable.
+  meta_.assign(meta.begin(), meta.end());
+  items_.assign(items.begin(), items.end());
+  freelist_front_ = freelist_front;
+  freelist_back_ = freelist_back;
+  fragmented_ = true;
+  return true;
+}
+
 template <typename T>
 template <typename Compare>
 auto ResourceTable<T>::Defragment(Compare comp, const size_t max_swaps)
@@ -222,6 +222,102 @@ TEST(ResourceTableTest, Defragment) {
   EXPECT_EQ(swaps, 2);
 }
 
+// NOLINTNEXTLINE
+TEST(ResourceTableTest, RestorePreservesHandles) {
+  static constexpr size_t kCapacity{5};
+  static constexpr ResourceHandle::ResourceTypeT kItemType{1};
+
+  ResourceTable<int> table(kItemType, kCapacity);
+  const auto handle_1 = table.Emplace(1);
+  const auto handle_2 = table.Emplace(2);
+  const auto handle_3 = table.Emplace(3);
+  table.Erase(handle_2);
+
+  std::vector<ResourceHandle::HandleT> sparse;
+  std::ranges::transform(table.SparseItems(), std::back_inserter(sparse),
+      [](const auto &handle) { return handle.Handle(); });
+
+  ResourceTable<int> restored(kItemType, kCapacity);
+  EXPECT_TRUE(restored.Restore(sparse, table.MetaItems(), table.Items(),
+      table.FreeListFront(), table.FreeListBack()));
+  EXPECT_EQ(restored.Size(), 2);
+  EXPECT_TRUE(restored.Contains(handle_1));
+  EXPECT_FALSE(restored.Contains(handle_2));
+  EXPECT_TRUE(restored.Contains(handle_3));
+  EXPECT_EQ(restored.ItemAt(handle_1), 1);
+  EXPECT_EQ(restored.ItemAt(handle_3), 3);
+
+  // The freelist is restored too, so new handles match the original table.
+  EXPECT_EQ(restored.Emplace(4), table.Emplace(4));
+}
+
+// NOLINTNEXTLINE
+TEST(ResourceTableTest, RestoreRejectsInconsistentSets) {
+  static constexpr size_t kCapacity{5};
+  static constexpr ResourceHandle::ResourceTypeT kItemType{1};
+
+  ResourceTable<int> table(kItemType, kCapacity);
+  table.Emplace(1);
+  const std::vector<int> items{1, 2};
+  const std::vector<ResourceHandle::HandleT> sparse{
+      ResourceHandle(0, kItemType).Handle()};
+
+  EXPECT_FALSE(table.Restore(sparse, table.MetaItems(), items,
+      ResourceHandle::kInvalidIndex, ResourceHandle::kInvalidIndex));
+  EXPECT_TRUE(table.IsEmpty());
+}
+
+// NOLINTNEXTLINE
+TEST(ResourceTableTest, RestoreRejectsCorruptedHandles) {
+  static constexpr size_t kCapacity{5};
+  static constexpr ResourceHandle::ResourceTypeT kItemType{1};
+
+  ResourceTable<int> table(kItemType, kCapacity);
+  table.Emplace(1);
+  const auto handle_2 = table.Emplace(2);
+  table.Emplace(3);
+  table.Erase(handle_2);
+
+  std::vector<ResourceHandle::HandleT> sparse;
+  std::ranges::transform(table.SparseItems(), std::back_inserter(sparse),
+      [](const auto &handle) { return handle.Handle(); });
+  const auto restore = [&](const std::vector<ResourceHandle::HandleT> &sets,
+                           const ResourceHandle::IndexT front,
+                           const ResourceHandle::IndexT back) {
+    ResourceTable<int> restored(kItemType, kCapacity);
+    const auto result =
+        restored.Restore(sets, table.MetaItems(), table.Items(), front, back);
+    EXPECT_EQ(result, !restored.IsEmpty());
+    return result;
+  };
+  ASSERT_TRUE(restore(sparse, table.FreeListFront(), table.FreeListBack()));
+
+  // Freelist starting at a handle in use.
+  EXPECT_FALSE(restore(sparse, 0, 0));
+  // Freelist ending before its back.
+  EXPECT_FALSE(restore(sparse, table.FreeListFront(), 0));
+
+  // Free handle pointing outside of the sparse set.
+  auto out_of_range = sparse;
+  ResourceHandle free_handle;
+  free_handle.SetHandle(out_of_range[1]);
+  free_handle.SetIndex(7);
+  out_of_range[1] = free_handle.Handle();
+  EXPECT_FALSE(
+      restore(out_of_range, table.FreeListFront(), table.FreeListBack()));
+
+  // Free handle chaining to itself.
+  free_handle.SetIndex(1);
+  auto cycle = sparse;
+  cycle[1] = free_handle.Handle();
+  EXPECT_FALSE(restore(cycle, table.FreeListFront(), table.FreeListBack()));
+
+  // Two handles in use sharing the same item.
+  auto shared = sparse;
+  shared[2] = shared[0];
+  EXPECT_FALSE(restore(shared, table.FreeListFront(), table.FreeListBack()));
+}
+
 class ResourceTableTestPreFilled : public testing::Test {
 public:
   static constexpr size_t kCapacity{3};
@@ -0,0 +1,144 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+// Micro-benchmark of the job system scheduling overhead.
+//
+// Each scenario runs a number of repetitions and reports the best time, which
+// is the least affected by the noise of other processes. Jobs do no work, or
+// very little, so that the measured time is dominated by the cost of
+// scheduling, stealing and waiting.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <numeric>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "oxygen/base/compilers.h"
+
+OXYGEN_DIAGNOSTIC_PUSH
+#if defined(__clang__) || defined(ASAP_GNUC_VERSION)
+#pragma GCC diagnostic ignored "-Wswitch-enum"
+#pragma GCC diagnostic ignored "-Wswitch-default"
+#endif
+#include "fmt/core.h"
+OXYGEN_DIAGNOSTIC_POP
+
+#include "oxygen/core/job_system.h"
+
+using oxygen::core::JobCounter;
+using oxygen::core::JobSystem;
+
+namespace {
+
+constexpr int kRepetitions = 20;
+
+auto BestOf(const std::function<void()> &scenario) -> std::chrono::nanoseconds {
+  auto best = std::chrono::nanoseconds::max();
+  for (int repetition = 0; repetition < kRepetitions; ++repetition) {
+    const auto start = std::chrono::steady_clock::now();
+    scenario();
+    best = std::min(best, std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now() - start));
+  }
+  return best;
+}
+
+void Report(std::string_view name, const std::chrono::nanoseconds duration,
+    const size_t operations) {
+  fmt::print("{:<40} {:>12} ns {:>10.1f} ns/op\n", name, duration.count(),
+      static_cast<double>(duration.count()) / static_cast<double>(operations));
+}
+
+} // namespace
+
+auto main(int argc, char *argv[]) -> int {
+  JobSystem::Properties props{};
+  if (argc > 1) {
+    props.worker_count = static_cast<size_t>(std::atoi(argv[1]));
+  }
+  JobSystem job_system(props);
+  fmt::print("Job system with {} workers, best of {} repetitions\n\n",
+      job_system.WorkerCount(), kRepetitions);
+
+  constexpr size_t kJobs = 10'000;
+  std::atomic<size_t> sink{0};
+
+  const auto counter_jobs = BestOf([&]() {
+    JobCounter counter;
+    for (size_t index = 0; index < kJobs; ++index) {
+      job_system.Schedule(
+          [&sink]() { sink.fetch_add(1, std::memory_order_relaxed); },
+          counter);
+    }
+    job_system.Wait(counter);
+  });
+  Report("Schedule + Wait, empty jobs (counter)", counter_jobs, kJobs);
+
+  const auto handle_jobs = BestOf([&]() {
+    std::vector<oxygen::core::JobHandle> handles;
+    handles.reserve(kJobs);
+    for (size_t index = 0; index < kJobs; ++index) {
+      handles.push_back(job_system.Schedule(
+          [&sink]() { sink.fetch_add(1, std::memory_order_relaxed); }));
+    }
+    for (const auto &handle : handles) {
+      job_system.Wait(handle);
+    }
+  });
+  Report("Schedule + Wait, empty jobs (handle)", handle_jobs, kJobs);
+
+  const auto round_trips = BestOf([&]() {
+    for (size_t index = 0; index < 1'000; ++index) {
+      job_system.Wait(job_system.Schedule(
+          [&sink]() { sink.fetch_add(1, std::memory_order_relaxed); }));
+    }
+  });
+  Report("Single job round trip", round_trips, 1'000);
+
+  const auto nested_jobs = BestOf([&]() {
+    JobCounter counter;
+    for (size_t index = 0; index < 100; ++index) {
+      job_system.Schedule(
+          [&]() {
+            JobCounter children;
+            for (size_t child = 0; child < 100; ++child) {
+              job_system.Schedule(
+                  [&sink]() { sink.fetch_add(1, std::memory_order_relaxed); },
+                  children);
+            }
+            job_system.Wait(children);
+          },
+          counter);
+    }
+    job_system.Wait(counter);
+  });
+  Report("Nested: 100 jobs x 100 children", nested_jobs, 100 * 100);
+
+  constexpr size_t kItems = 1'000'000;
+  std::vector<float> items(kItems);
+  std::iota(items.begin(), items.end(), 0.F);
+  const auto serial = BestOf([&]() {
+    for (auto &item : items) {
+      item = item * 0.5F + 1.F;
+    }
+  });
+  Report("Serial loop, 1M floats", serial, kItems);
+  const auto parallel = BestOf([&]() {
+    job_system.ParallelFor(
+        std::span(items), [](float &item) { item = item * 0.5F + 1.F; });
+  });
+  Report("ParallelFor, 1M floats", parallel, kItems);
+  fmt::print("\nParallelFor speedup: {:.2f}x\n",
+      static_cast<double>(serial.count()) /
+          static_cast<double>(parallel.count()));
+
+  return sink.load() != 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
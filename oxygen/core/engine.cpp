@@ -7,7 +7,9 @@
 #include "oxygen/core/engine.h"
 
 #include <algorithm>
+#include <cstddef>
 #include <ranges>
+#include <span>
 
 #if 0
 #include <vulkan/vulkan_core.h>
@@ -18,6 +20,15 @@
 #endif
 
 #include "oxygen/base/time.h"
+#include "oxygen/core/frame_arena.h"
+#include "oxygen/core/frame_pacer.h"
+#include "oxygen/core/job_system.h"
+#include "oxygen/core/module_stats.h"
+#include "oxygen/core/system_scheduler.h"
+#include "oxygen/core/time_slicer.h"
+#include "oxygen/platform/input_coalescing.h"
+#include "oxygen/platform/input_event.h"
+#include "oxygen/platform/input_recording.h"
 #include "oxygen/platform/platform.h"
 
 #include "oxygen/logging/logging.h"
@@ -28,7 +39,19 @@
 namespace {
 auto &core_logger = // NOLINT(*-avoid-non-const-global-variables)
     oxygen::log::Registry::Instance().GetLogger("Oxygen.Engine.Core");
+
+// Input events are polled from the platform in batches of this size.
+constexpr size_t kInputEventBatchSize{64};
+
+// Call `fn`, and record how long it took in the module statistics.
+template <typename Fn>
+void Timed(oxygen::core::ModuleStats &stats,
+    const oxygen::core::ModulePhase phase, Fn &&fn) {
+  const auto start = oxygen::Time::Now();
+  fn();
+  stats.Record(phase, oxygen::Time::Now() - start);
 }
+} // namespace
 
 using oxygen::Engine;
 // using oxygen::core::DeviceRequirements;
@@ -195,7 +218,16 @@ Engine::Engine(Platform &platform, Properties props)
           .extensions = props.extensions,
       })),
 #endif
-      props_(std::move(props)) {
+      props_(std::move(props)),
+      job_system_(std::make_unique<core::JobSystem>(core::JobSystem::Properties{
+          .worker_count = props_.worker_threads,
+      })),
+      system_scheduler_(
+          std::make_unique<engine::SystemScheduler>(*job_system_)),
+      frame_arena_(
+          std::make_unique<core::FrameArena>(props_.frame_arena_capacity)),
+      frame_pacer_(std::make_unique<core::FramePacer>(props_.target_fps)),
+      time_slicer_(std::make_unique<core::TimeSlicer>()) {
   // DiscoverDevices();
   ASLOG_TO_LOGGER(core_logger, info, "Engine initialization complete");
 }
@@ -210,6 +242,35 @@ auto Engine::GetPlatform() const -> Platform & {
   return platform_;
 }
 
+auto Engine::GetJobSystem() const -> core::JobSystem & {
+  return *job_system_;
+}
+
+auto Engine::GetFrameArena() const -> core::FrameArena & {
+  return *frame_arena_;
+}
+
+auto Engine::GetFramePacer() const -> core::FramePacer & {
+  return *frame_pacer_;
+}
+
+auto Engine::GetTimeSlicer() const -> core::TimeSlicer & {
+  return *time_slicer_;
+}
+
+void Engine::SetInputRecorder(
+    std::shared_ptr<platform::InputRecorder> recorder) {
+  input_recorder_ = std::move(recorder);
+}
+
+void Engine::SetFrameClock(std::function<Duration()> frame_clock) {
+  frame_clock_ = std::move(frame_clock);
+}
+
+auto Engine::GetSystemScheduler() const -> engine::SystemScheduler & {
+  return *system_scheduler_;
+}
+
 #if 0
 auto Engine::GetInstance() const -> VkInstance const&
 {
@@ -218,7 +279,74 @@ auto Engine::GetInstance() const -> VkInstance const&
 #endif
 
 void Engine::AddModule(std::weak_ptr<core::Module> module) {
-  modules_.push_back(ModuleContext{.module = std::move(module)});
+  AddModule(std::move(module), ModuleOptions{});
+}
+
+void Engine::AddModule(
+    std::weak_ptr<core::Module> module, ModuleOptions options) {
+  const auto frame_interval =
+      core::FramePacer::FrameTimeFor(options.target_fps);
+  modules_.push_back(ModuleContext{
+      .module = std::move(module),
+      .options = std::move(options),
+      .fixed_step = core::FixedStep({
+          .interval = Duration(core::kDefaultFixedIntervalDuration),
+          .max_frame_duration = props_.max_fixed_update_duration,
+          .max_substeps = props_.max_fixed_substeps,
+          .dilate_time = props_.dilate_time_when_overloaded,
+      }),
+      .frame_interval = frame_interval,
+  });
+}
+
+void Engine::RequestFrame() {
+  frame_requested_.store(true);
+  // The engine loop may be blocked waiting for platform events.
+  GetPlatform().Wake();
+}
+
+void Engine::RequestFrameIn(const Duration delay) {
+  const auto wake_up = (Time::Now() + delay).count();
+  auto current = next_wake_up_.load();
+  while (wake_up < current) {
+    if (next_wake_up_.compare_exchange_weak(current, wake_up)) {
+      // The wait in progress, if any, may end later than the new wake up.
+      GetPlatform().Wake();
+      return;
+    }
+  }
+}
+
+auto Engine::GetModuleTimings(const core::Module &module) const
+    -> core::ModuleTimings {
+  const auto found = std::ranges::find_if(modules_, [&module](auto &context) {
+    return context.module.lock().get() == &module;
+  });
+  return found != modules_.end()
+             ? ModuleTimingsAt(static_cast<size_t>(found - modules_.begin()))
+             : core::ModuleTimings{};
+}
+
+auto Engine::ModuleTimingsAt(const size_t index) const -> core::ModuleTimings {
+  const auto &module = modules_[index];
+  auto timings = module.stats.Timings();
+  timings.fps = module.fps.Value();
+  timings.ups = module.ups.Value();
+  return timings;
+}
+
+auto Engine::GetFixedStepStats(const core::Module &module) const
+    -> core::FixedStep::Stats {
+  const auto found = std::ranges::find_if(modules_, [&module](auto &context) {
+    return context.module.lock().get() == &module;
+  });
+  return found != modules_.end() ? found->fixed_step.GetStats()
+                                 : core::FixedStep::Stats{};
+}
+
+auto Engine::AddSystem(std::weak_ptr<engine::System> system,
+    engine::SystemDescriptor descriptor) -> bool {
+  return system_scheduler_->Register(std::move(system), std::move(descriptor));
 }
 
 auto Engine::Run() -> void {
@@ -228,67 +356,108 @@ auto Engine::Run() -> void {
   auto lastWindowClosedCon = GetPlatform().OnLastWindowClosed().connect(
       [&continue_running]() { continue_running = false; });
 
-  std::ranges::for_each(modules_, [](auto &module) {
-    if (auto the_module = module.module.lock()) {
-      the_module->Initialize();
-    }
-  });
+  InitializeModules();
 
   // Start the master clock
   engine_clock_.Reset();
+  const ElapsedTimeCounter time_since_start{};
+  // Sum of the frame durations given by the frame clock, if any.
+  Duration frame_clock_time{0};
 
   // https://gafferongames.com/post/fix_your_timestep/
-  std::ranges::for_each(
-      modules_, [](auto &module) { module.frame_time.Reset(); });
+  frame_pacer_->Reset();
 
   while (continue_running) {
-    auto event = GetPlatform().PollEvent();
-    std::ranges::for_each(
-        modules_, [this, &continue_running, &event](auto &module) {
-          if (auto the_module = module.module.lock()) {
-            // Inputs
-            if (event) {
-              the_module->ProcessInput(*event);
-            }
+    if (props_.on_demand_frames) {
+      WaitForFrameRequest();
+    }
 
-            if (continue_running) {
-              module.frame_time.Update();
-              auto delta = module.frame_time.Delta();
+    // Memory allocated two frames ago is no longer in use.
+    frame_arena_->NextFrame();
+
+    // Drain all pending events, so that a burst of input is handled in a
+    // single frame instead of one frame per event. The events of the previous
+    // frame are released first.
+    frame_events_.clear();
+    GetPlatform().NewFrame();
+    size_t polled{0};
+    do {
+      const auto offset = frame_events_.size();
+      frame_events_.resize(offset + kInputEventBatchSize);
+      polled = GetPlatform().PollEvents(
+          std::span(frame_events_).subspan(offset, kInputEventBatchSize));
+      frame_events_.resize(offset + polled);
+    } while (polled == kInputEventBatchSize);
+    // The frame duration is measured once the events are polled, so that it
+    // covers the same time as the events, and replays can substitute the
+    // recorded one.
+    engine_clock_.Update();
+    auto delta_time = engine_clock_.Delta();
+    auto now = time_since_start.ElapsedTime();
+    if (frame_clock_) {
+      delta_time = frame_clock_();
+      frame_clock_time += delta_time;
+      now = frame_clock_time;
+    }
+    if (input_recorder_) {
+      input_recorder_->RecordFrame(delta_time, frame_events_);
+    }
+    // Recordings keep every sample, replays go through the same merging.
+    if (props_.coalesce_mouse_events) {
+      platform::CoalesceMouseEvents(frame_events_);
+    }
 
-              // Fixed updates
-              if (delta > props_.max_fixed_update_duration) {
-                delta = props_.max_fixed_update_duration;
-              }
-              module.fixed_accumulator += module.frame_time.Delta();
-              while (module.fixed_accumulator >= module.fixed_interval) {
-                the_module->FixedUpdate(
-                    //  module.time_since_start.ElapsedTime(),
-                    // module.fixed_interval
-                );
-                module.fixed_accumulator -= module.fixed_interval;
-                module.ups.Update();
+    // Inputs, each module only receives the events it is interested in, and
+    // is not even locked when there are none.
+    RouteInputEvents();
+    std::ranges::for_each(modules_, [](auto &module) {
+      if (module.input_events.empty()) {
+        return;
+      }
+      if (auto the_module = module.module.lock()) {
+        Timed(module.stats, core::ModulePhase::kProcessInput,
+            [&module, &the_module]() {
+              for (const auto *event : module.input_events) {
+                the_module->ProcessInput(*event);
               }
-              // TODO(abdessattar): Interpolate the remaining time in the
-              // accumulator const float alpha =
-              //    static_cast<float>(module.fixed_accumulator.count()) /
-              //    static_cast<float>(module.fixed_interval.count());
-              // the_module->FixedUpdate(/*alpha*/);
-
-              // Per frame updates / render
-              the_module->Update(module.frame_time.Delta());
-              the_module->Render();
-              module.fps.Update();
-
-              // TODO: replace this log using spdlog
-              // VLOG(1) << "FPS: " << module.fps.Value()
-              //         << " UPS: " << module.ups.Value();
-            }
-          }
-        });
+            });
+      }
+    });
+    if (!continue_running) {
+      break;
+    }
+
+    if (props_.pipeline_depth == 0) {
+      Simulate(now, delta_time);
+      RenderModules();
+      EndFrame();
+      continue;
+    }
+
+    // Pipelined: simulate the next frame on the job system, while this thread
+    // renders the frame packets published by the previous ones.
+    const auto simulation = job_system_->Schedule(
+        [this, now, delta_time]() { Simulate(now, delta_time); });
+    RenderPipelinedModules();
+    job_system_->Wait(simulation);
+    std::ranges::for_each(modules_, [](auto &module) {
+      if (module.published_packet) {
+        module.packets.push_back(std::move(module.published_packet));
+      } else if (auto the_module = module.module.lock();
+                 the_module && module.due) {
+        // Without a packet, rendering cannot overlap with the simulation.
+        Timed(module.stats, core::ModulePhase::kRender,
+            [&the_module]() { the_module->Render(); });
+        module.fps.Update();
+      }
+    });
+    EndFrame();
   }
   ASLOG_TO_LOGGER(core_logger, info, "Engine stopped.");
 
-  std::ranges::for_each(modules_, [](auto &module) {
+  std::ranges::for_each(modules_, [this](auto &module) {
+    // Modules not required for the first frame may still be initializing.
+    job_system_->Wait(module.initialization);
     if (auto the_module = module.module.lock()) {
       the_module->Shutdown();
     }
@@ -298,6 +467,336 @@ auto Engine::Run() -> void {
   lastWindowClosedCon.disconnect();
 }
 
+void Engine::Simulate(
+    const Duration time_since_start, const Duration delta_time) {
+  // Systems, in parallel when their dependencies allow it
+  system_scheduler_->Update(engine::SystemUpdateContext{
+      .time_since_start = time_since_start,
+      .delta_time = delta_time,
+      .frame_memory = &frame_arena_->Resource(),
+  });
+
+  // Modules with a frame rate limit are due when their next frame starts
+  // before the middle of this engine frame.
+  const auto now = Time::Now();
+  const auto due_time = now + frame_pacer_->TargetFrameTime() / 2;
+
+  std::ranges::for_each(modules_, [this, now, due_time](auto &module) {
+    module.due = module.initialization.IsDone();
+    if (module.due && !module.started) {
+      // Do not account for the time spent initializing.
+      module.started = true;
+      module.frame_time.Reset();
+      module.next_frame = now;
+    }
+    if (module.due && module.frame_interval != Duration::zero()) {
+      module.due = module.next_frame <= due_time;
+      if (module.due) {
+        module.next_frame += module.frame_interval;
+        module.next_frame = std::max(module.next_frame, now);
+      }
+    }
+    if (!module.due) {
+      return;
+    }
+    if (auto the_module = module.module.lock()) {
+      module.frame_time.Update();
+
+      // Fixed updates
+      const auto steps = module.fixed_step.Advance(module.frame_time.Delta());
+      for (uint32_t step = 0; step < steps; ++step) {
+        Timed(module.stats, core::ModulePhase::kFixedUpdate,
+            [&the_module]() { the_module->FixedUpdate(); });
+        module.ups.Update();
+      }
+
+      // Per frame updates
+      Timed(module.stats, core::ModulePhase::kUpdate,
+          [this, &module, &the_module]() {
+            the_module->Update(
+                module.frame_time.Delta(), module.fixed_step.Alpha());
+            if (props_.pipeline_depth != 0) {
+              module.published_packet = the_module->PublishFramePacket();
+            }
+          });
+    }
+  });
+}
+
+void Engine::RenderModules() {
+  std::ranges::for_each(modules_, [](auto &module) {
+    if (!module.due) {
+      return;
+    }
+    if (auto the_module = module.module.lock()) {
+      Timed(module.stats, core::ModulePhase::kRender,
+          [&the_module]() { the_module->Render(); });
+      module.fps.Update();
+    }
+  });
+}
+
+void Engine::RenderPipelinedModules() {
+  std::ranges::for_each(modules_, [this](auto &module) {
+    // The queue fills up during the first frames, and is never full for
+    // modules that do not publish packets.
+    if (module.packets.size() < props_.pipeline_depth) {
+      return;
+    }
+    if (auto the_module = module.module.lock()) {
+      Timed(module.stats, core::ModulePhase::kRender, [&module, &the_module]() {
+        the_module->RenderFramePacket(*module.packets.front());
+      });
+      module.fps.Update();
+    }
+    module.packets.pop_front();
+  });
+}
+
+void Engine::InitializeModules() {
+  const auto start = Time::Now();
+  const auto count = modules_.size();
+
+  // Resolve the dependencies, then order the modules so that each one comes
+  // after its dependencies.
+  std::vector<std::vector<size_t>> dependencies(count);
+  for (size_t index = 0; index < count; ++index) {
+    for (const auto &dependency : modules_[index].options.initialize_after) {
+      const auto locked = dependency.lock();
+      const auto found = std::ranges::find_if(modules_,
+          [&locked](auto &module) { return module.module.lock() == locked; });
+      if (!locked || found == modules_.end()) {
+        ASLOG_TO_LOGGER(core_logger, warn,
+            "Module #{} depends on a module that was not added", index);
+        continue;
+      }
+      dependencies[index].push_back(
+          static_cast<size_t>(found - modules_.begin()));
+    }
+  }
+  std::vector<size_t> order;
+  order.reserve(count);
+  std::vector<bool> ordered(count, false);
+  while (order.size() < count) {
+    const auto before = order.size();
+    for (size_t index = 0; index < count; ++index) {
+      if (!ordered[index] &&
+          std::ranges::all_of(dependencies[index],
+              [&ordered](const size_t dependency) {
+                return ordered[dependency];
+              })) {
+        ordered[index] = true;
+        order.push_back(index);
+      }
+    }
+    if (order.size() == before) {
+      ASLOG_TO_LOGGER(core_logger, error,
+          "The module initialization dependencies contain a cycle, modules "
+          "will be initialized one after the other");
+      order.clear();
+      for (size_t index = 0; index < count; ++index) {
+        order.push_back(index);
+        dependencies[index].clear();
+        if (index != 0) {
+          dependencies[index].push_back(index - 1);
+        }
+      }
+    }
+  }
+
+  // The dependencies of a module required for the first frame, or
+  // initialized on this thread, are required too. The others are left to the
+  // workers, in the background, so that the main thread does not pick them up
+  // while it waits for the frame jobs.
+  std::vector<bool> required(count, false);
+  for (const auto index : std::views::reverse(order)) {
+    const auto &module = modules_[index];
+    if (const auto the_module = module.module.lock();
+        module.options.required_for_first_frame ||
+        (the_module && the_module->InitializesOnMainThread())) {
+      required[index] = true;
+    }
+    if (required[index]) {
+      for (const auto dependency : dependencies[index]) {
+        required[dependency] = true;
+      }
+    }
+  }
+
+  // Modules that can initialize on any thread are started as jobs, after
+  // their dependencies. The others initialize on this thread, which helps
+  // with the jobs while it waits for their dependencies.
+  for (const auto index : order) {
+    auto &module = modules_[index];
+    auto the_module = module.module.lock();
+    if (!the_module) {
+      continue;
+    }
+    std::vector<core::JobHandle> waits;
+    waits.reserve(dependencies[index].size());
+    for (const auto dependency : dependencies[index]) {
+      waits.push_back(modules_[dependency].initialization);
+    }
+    if (the_module->InitializesOnMainThread()) {
+      for (const auto &wait : waits) {
+        job_system_->Wait(wait);
+      }
+      the_module->Initialize();
+      continue;
+    }
+    auto initialize = [this, the_module = std::move(the_module),
+                          waits = std::move(waits)]() {
+      for (const auto &wait : waits) {
+        job_system_->Wait(wait);
+      }
+      the_module->Initialize();
+    };
+    module.initialization =
+        required[index]
+            ? job_system_->Schedule(std::move(initialize))
+            : job_system_->ScheduleBackground(std::move(initialize));
+  }
+
+  for (const auto &module : modules_) {
+    if (module.options.required_for_first_frame) {
+      job_system_->Wait(module.initialization);
+    }
+  }
+  ASLOG_TO_LOGGER(core_logger, info, "Modules initialized in {} ms",
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          Time::Now() - start)
+          .count());
+}
+
+void Engine::RouteInputEvents() {
+  bool changed{false};
+  for (auto &module : modules_) {
+    if (!module.routed && module.initialization.IsDone()) {
+      if (auto the_module = module.module.lock()) {
+        module.input_interest = the_module->GetInputInterest();
+      }
+      module.routed = true;
+      changed = true;
+    }
+  }
+  if (changed) {
+    for (size_t type = 0; type < input_routes_.size(); ++type) {
+      input_routes_[type].clear();
+      for (size_t index = 0; index < modules_.size(); ++index) {
+        const auto &module = modules_[index];
+        if (module.routed &&
+            module.input_interest.Wants(
+                static_cast<platform::InputEventType>(type))) {
+          input_routes_[type].push_back(index);
+        }
+      }
+    }
+  }
+
+  std::ranges::for_each(
+      modules_, [](auto &module) { module.input_events.clear(); });
+  for (const auto &event : frame_events_) {
+    for (const auto index :
+        input_routes_[static_cast<size_t>(event.GetType())]) {
+      auto &module = modules_[index];
+      const auto window_id = module.input_interest.window_id;
+      if (window_id == platform::kInvalidWindowId ||
+          event.IsFromWindow(window_id)) {
+        module.input_events.push_back(&event);
+      }
+    }
+  }
+}
+
+void Engine::EndFrame() {
+  // The time left until the next frame is due goes to the time-sliced work,
+  // instead of waiting.
+  if (time_slicer_->Size() != 0) {
+    auto deadline = Time::Now() + props_.min_time_slice;
+    if (frame_pacer_->TargetFrameTime() != Duration::zero()) {
+      deadline = std::max(deadline, frame_pacer_->NextFrameDeadline());
+    }
+    time_slicer_->Run(deadline);
+  }
+  frame_pacer_->EndFrame();
+  std::ranges::for_each(
+      modules_, [](auto &module) { module.stats.EndFrame(); });
+
+  if (props_.stats_log_interval == Duration::zero()) {
+    return;
+  }
+  const auto now = Time::Now();
+  if (now < next_stats_log_) {
+    return;
+  }
+  next_stats_log_ = now + props_.stats_log_interval;
+
+  const auto frame = frame_pacer_->GetStats();
+  ASLOG_TO_LOGGER(core_logger, info,
+      "Frame time avg {} us, max {} us, jitter {} us",
+      frame.average_frame_time.count(), frame.max_frame_time.count(),
+      frame.jitter.count());
+  for (size_t index = 0; index < modules_.size(); ++index) {
+    const auto timings = ModuleTimingsAt(index);
+    ASLOG_TO_LOGGER(core_logger, info,
+        "Module #{}: {} fps, {} ups, avg us: input {}, fixed update {}, "
+        "update {}, render {}",
+        index, timings.fps, timings.ups,
+        timings[core::ModulePhase::kProcessInput].average.count(),
+        timings[core::ModulePhase::kFixedUpdate].average.count(),
+        timings[core::ModulePhase::kUpdate].average.count(),
+        timings[core::ModulePhase::kRender].average.count());
+    ASLOG_TO_LOGGER(core_logger, info,
+        "Module #{}: max us: input {}, fixed update {}, update {}, render {}",
+        index, timings[core::ModulePhase::kProcessInput].max.count(),
+        timings[core::ModulePhase::kFixedUpdate].max.count(),
+        timings[core::ModulePhase::kUpdate].max.count(),
+        timings[core::ModulePhase::kRender].max.count());
+  }
+}
+
+void Engine::WaitForFrameRequest() {
+  if (frame_requested_.exchange(false)) {
+    return;
+  }
+
+  // Render the frames already simulated before going idle.
+  std::ranges::for_each(modules_, [](auto &module) {
+    auto the_module = module.module.lock();
+    for (const auto &packet : module.packets) {
+      if (the_module) {
+        Timed(module.stats, core::ModulePhase::kRender,
+            [&packet, &the_module]() {
+              the_module->RenderFramePacket(*packet);
+            });
+        module.fps.Update();
+      }
+    }
+    module.packets.clear();
+  });
+
+  const auto wake_up = next_wake_up_.load();
+  auto timeout = Duration(-1);
+  if (wake_up != TimePoint::max().count()) {
+    timeout = std::max(TimePoint(wake_up) - Time::Now(), Duration::zero());
+  }
+  if (timeout != Duration::zero()) {
+    GetPlatform().WaitForEvents(timeout);
+  }
+  if (Time::Now().count() >= wake_up) {
+    // A later request may have replaced it in the meantime.
+    auto expected = wake_up;
+    next_wake_up_.compare_exchange_strong(
+        expected, TimePoint::max().count());
+  }
+
+  // The simulation does not advance while idle, and the first frame after it
+  // does not see the idle time as its duration.
+  engine_clock_.Reset();
+  std::ranges::for_each(
+      modules_, [](auto &module) { module.frame_time.Reset(); });
+}
+
 auto oxygen::Engine::Name() -> const std::string & {
   static const std::string kName{"Oxygen"};
   return kName;
@@ -6,6 +6,10 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <deque>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -13,17 +17,31 @@
 // #include <vulkan/vulkan_core.h>
 
 #include "oxygen/base/time.h"
+#include "oxygen/core/fixed_step.h"
+#include "oxygen/core/job_system.h"
+#include "oxygen/core/module.h"
+#include "oxygen/core/module_stats.h"
 #include "oxygen/platform/fwd.h"
+#include "oxygen/platform/input_event.h"
 
 namespace oxygen {
 
-constexpr uint64_t kDefaultFixedUpdateDuration{200'000};
-constexpr uint64_t kDefaultFixedIntervalDuration{20'000};
+constexpr size_t kDefaultFrameArenaCapacity{1U << 20U};
+constexpr Duration kDefaultMinTimeSlice{500};
 
 namespace core {
-class Module;
+class FrameArena;
+class FramePacer;
+class FramePacket;
+class TimeSlicer;
 } // namespace core
 
+namespace engine {
+class System;
+class SystemScheduler;
+struct SystemDescriptor;
+} // namespace engine
+
 #if 0
 namespace engine {
 
@@ -75,7 +93,41 @@ public:
       uint32_t version;
     } application;
     std::vector<const char *> extensions; // Vulkan instance extensions
-    Duration max_fixed_update_duration{kDefaultFixedUpdateDuration};
+    // Maximum frame time accounted for by the fixed updates in one frame.
+    Duration max_fixed_update_duration{core::kDefaultFixedUpdateDuration};
+    // Maximum number of fixed updates run in one frame.
+    uint32_t max_fixed_substeps{core::kDefaultMaxFixedSubsteps};
+    // When the fixed updates cannot keep up, slow down the simulation instead
+    // of catching up over the next frames.
+    bool dilate_time_when_overloaded{true};
+    // Number of job system worker threads, `0` for one per core minus one.
+    size_t worker_threads{0};
+    // Initial size of the per-frame memory, which grows as needed.
+    size_t frame_arena_capacity{kDefaultFrameArenaCapacity};
+    // Number of frames by which rendering lags behind the simulation. With
+    // `0`, each frame is simulated then rendered on the main thread. Otherwise,
+    // the simulation of a frame runs on the job system while the main thread
+    // renders the frame packet published `pipeline_depth` frames earlier,
+    // trading that much latency for overlapping the two stages. A depth of `1`
+    // is enough for the overlap; more only keeps packets alive longer.
+    size_t pipeline_depth{0};
+    // Maximum frame rate of the engine loop, `0` for unlimited.
+    float target_fps{0.0F};
+    // When `true`, the engine loop only runs a frame when one is requested
+    // with `RequestFrame()`, when a requested wake up time is reached, or
+    // when a platform event arrives. Otherwise, it blocks until then.
+    bool on_demand_frames{false};
+    // Interval between two summaries of the frame and module timings in the
+    // engine log, `0` to never log them.
+    Duration stats_log_interval{0};
+    // Minimum time given to the time-sliced work at the end of each frame,
+    // even without slack, so that it makes progress when the frames are busy.
+    Duration min_time_slice{kDefaultMinTimeSlice};
+    // Merge the mouse motion and wheel events of each window between its
+    // other events, e.g. clicks, before they are routed to the modules.
+    // Disable for modules that need every sample of the mouse, e.g. for
+    // drawing.
+    bool coalesce_mouse_events{true};
   };
 
   Engine(Platform &platform, Properties props);
@@ -91,7 +143,72 @@ public:
 
   [[nodiscard]] auto GetPlatform() const -> Platform &;
 
+  //! The job system shared by all modules and systems, available for the whole
+  //! lifetime of the engine.
+  [[nodiscard]] auto GetJobSystem() const -> core::JobSystem &;
+
+  //! Memory for the transient allocations of the current frame. Allocated data
+  //! stays valid until the end of the next frame.
+  [[nodiscard]] auto GetFrameArena() const -> core::FrameArena &;
+
+  //! Paces the engine loop to the target frame rate, and measures the frame
+  //! time jitter.
+  [[nodiscard]] auto GetFramePacer() const -> core::FramePacer &;
+
+  //! Runs low priority work, registered by modules and systems, in the slack
+  //! at the end of each frame, on the main thread.
+  [[nodiscard]] auto GetTimeSlicer() const -> core::TimeSlicer &;
+
+  //! Record the input events polled every frame with `recorder`, until it is
+  //! replaced or reset with `nullptr`.
+  void SetInputRecorder(std::shared_ptr<platform::InputRecorder> recorder);
+
+  //! Measure the duration of each frame with `frame_clock` instead of the wall
+  //! clock, for example to replay a recorded session with its own timing.
+  //! Called once per frame, after the input events are polled. The durations
+  //! are the `delta_time` of the systems, and add up to their
+  //! `time_since_start`. Reset with `nullptr` to use the wall clock again.
+  void SetFrameClock(std::function<Duration()> frame_clock);
+
+  //! Schedules the systems updated every frame, after the input events are
+  //! dispatched to the modules and before the modules are updated.
+  [[nodiscard]] auto GetSystemScheduler() const -> engine::SystemScheduler &;
+
+  //! Time spent by a module in each phase over the recent frames, with its
+  //! frame and fixed update rates.
+  [[nodiscard]] auto GetModuleTimings(
+      const core::Module &module) const -> core::ModuleTimings;
+
+  //! Statistics of the fixed updates of a module, to detect when the engine
+  //! struggles to keep up with them.
+  [[nodiscard]] auto GetFixedStepStats(
+      const core::Module &module) const -> core::FixedStep::Stats;
+
+  struct ModuleOptions {
+    // Maximum update and render rate of the module, `0` for every frame. The
+    // module rate is only reached if the engine loop runs at least as fast.
+    float target_fps{0.0F};
+    // Modules that must complete their initialization before this one starts
+    // its own.
+    std::vector<std::weak_ptr<core::Module>> initialize_after;
+    // When `false`, the frame loop may start before the module is initialized,
+    // and the module joins the loop once its initialization completes. Unless
+    // a required module depends on it, it initializes in the background, on
+    // the workers only.
+    bool required_for_first_frame{true};
+  };
+
   void AddModule(std::weak_ptr<core::Module> module);
+  void AddModule(std::weak_ptr<core::Module> module, ModuleOptions options);
+
+  //! On-demand mode only: run another frame after the current one, for
+  //! example while something is animating. Can be called from any thread.
+  void RequestFrame();
+  //! On-demand mode only: run a frame no later than `delay` from now, for
+  //! example when a timer is due. Can be called from any thread.
+  void RequestFrameIn(Duration delay);
+  auto AddSystem(std::weak_ptr<engine::System> system,
+      engine::SystemDescriptor descriptor) -> bool;
 
   auto Run() -> void;
 
@@ -118,21 +235,69 @@ private:
   auto DiscoverDevices() -> void;
 #endif
 
+  void Simulate(Duration time_since_start, Duration delta_time);
+  void RenderModules();
+  void RenderPipelinedModules();
+  void InitializeModules();
+  void RouteInputEvents();
+  void WaitForFrameRequest();
+  void EndFrame();
+  [[nodiscard]] auto ModuleTimingsAt(size_t index) const
+      -> core::ModuleTimings;
+
   Properties props_;
   Platform &platform_;
+  std::unique_ptr<core::JobSystem> job_system_;
+  std::unique_ptr<engine::SystemScheduler> system_scheduler_;
+  std::unique_ptr<core::FrameArena> frame_arena_;
+  std::unique_ptr<core::FramePacer> frame_pacer_;
+  std::unique_ptr<core::TimeSlicer> time_slicer_;
+  std::shared_ptr<platform::InputRecorder> input_recorder_;
 
   DeltaTimeCounter engine_clock_{};
+  std::function<Duration()> frame_clock_{};
 
   struct ModuleContext {
     std::weak_ptr<core::Module> module;
-    Duration fixed_interval{kDefaultFixedIntervalDuration};
-    Duration fixed_accumulator{};
+    ModuleOptions options;
+    // Done once the module initialization has completed.
+    core::JobHandle initialization{};
+    bool started{false};
+    // Input events of the current frame the module is interested in. The
+    // module joins the routing table once initialized.
+    core::InputInterest input_interest{};
+    bool routed{false};
+    std::vector<const platform::InputEvent *> input_events{};
+    core::FixedStep fixed_step;
+    // Module frame rate limit, if any, and whether the module is updated and
+    // rendered in the current frame.
+    Duration frame_interval{};
+    TimePoint next_frame{};
+    bool due{true};
     ElapsedTimeCounter time_since_start{};
     DeltaTimeCounter frame_time{};
     ChangePerSecondCounter fps{};
     ChangePerSecondCounter ups{};
+    core::ModuleStats stats{};
+    // Pipelined mode only: the packet published by the last simulation, and
+    // the packets waiting to be rendered, oldest first.
+    std::unique_ptr<const core::FramePacket> published_packet{};
+    std::deque<std::unique_ptr<const core::FramePacket>> packets{};
   };
   std::vector<ModuleContext> modules_;
+  TimePoint next_stats_log_{};
+
+  // On-demand mode: whether a frame has been requested, and the earliest
+  // requested wake up time.
+  std::atomic<bool> frame_requested_{true};
+  std::atomic<TimePoint::rep> next_wake_up_{TimePoint::max().count()};
+
+  // Input events drained from the platform at the start of the current frame.
+  // Kept as a member to reuse its storage from one frame to the next.
+  std::vector<platform::InputEvent> frame_events_;
+  // Indices of the modules interested in each type of input event.
+  std::array<std::vector<size_t>, platform::kInputEventTypeCount>
+      input_routes_;
 };
 
 } // namespace oxygen
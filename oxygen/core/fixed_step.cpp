@@ -0,0 +1,47 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "oxygen/core/fixed_step.h"
+
+#include <algorithm>
+#include <cassert>
+
+using oxygen::core::FixedStep;
+
+FixedStep::FixedStep(const Properties props) : props_(props) {
+  assert(props_.interval > Duration::zero());
+  assert(props_.max_substeps > 0);
+}
+
+auto FixedStep::Advance(const Duration frame_delta) -> uint32_t {
+  accumulator_ += std::min(frame_delta, props_.max_frame_duration);
+
+  auto steps = static_cast<uint64_t>(accumulator_ / props_.interval);
+  ++stats_.frames;
+  if (steps > 1) {
+    ++stats_.catch_up_frames;
+  }
+  if (steps > props_.max_substeps) {
+    ++stats_.capped_frames;
+    steps = props_.max_substeps;
+    if (props_.dilate_time) {
+      // Keep only the fraction of an interval, for a smooth interpolation.
+      const auto remainder = accumulator_ % props_.interval;
+      stats_.dilated_time +=
+          accumulator_ - remainder - steps * props_.interval;
+      accumulator_ = remainder;
+      return static_cast<uint32_t>(steps);
+    }
+  }
+  accumulator_ -= steps * props_.interval;
+  return static_cast<uint32_t>(steps);
+}
+
+auto FixedStep::Alpha() const noexcept -> float {
+  const auto alpha = static_cast<float>(accumulator_.count()) /
+                     static_cast<float>(props_.interval.count());
+  return std::min(alpha, 1.0F);
+}
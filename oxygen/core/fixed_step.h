@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cstdint>
+
+#include "oxygen/base/types.h"
+
+namespace oxygen::core {
+
+constexpr uint64_t kDefaultFixedIntervalDuration{20'000};
+constexpr uint64_t kDefaultFixedUpdateDuration{200'000};
+constexpr uint32_t kDefaultMaxFixedSubsteps{5};
+
+/*!
+ Decides how many fixed updates to run each frame, so that the simulation
+ advances by a fixed interval regardless of the frame rate.
+
+ See https://gafferongames.com/post/fix_your_timestep/. The frame time is
+ accumulated and consumed in fixed intervals, with two safeguards against the
+ "spiral of death", where slow fixed updates make the frames longer, which in
+ turn require more fixed updates:
+   - the time added per frame is clamped to `max_frame_duration`,
+   - at most `max_substeps` fixed updates run per frame.
+
+ When the substeps cap is reached, the remaining whole intervals are either
+ dropped (time dilation: the simulation runs slower than real time while
+ overloaded, but stays responsive), or carried over to be caught up during the
+ next frames.
+*/
+class FixedStep {
+public:
+  struct Properties {
+    Duration interval{kDefaultFixedIntervalDuration};
+    Duration max_frame_duration{kDefaultFixedUpdateDuration};
+    uint32_t max_substeps{kDefaultMaxFixedSubsteps};
+    bool dilate_time{true};
+  };
+
+  struct Stats {
+    uint64_t frames{0};
+    // Frames that ran more than one fixed update to catch up.
+    uint64_t catch_up_frames{0};
+    // Frames that reached the substeps cap.
+    uint64_t capped_frames{0};
+    // Simulation time dropped by time dilation.
+    Duration dilated_time{};
+  };
+
+  FixedStep() : FixedStep(Properties{}) {
+  }
+  explicit FixedStep(Properties props);
+
+  //! Accumulate the duration of the last frame and return the number of fixed
+  //! updates to run for it.
+  auto Advance(Duration frame_delta) -> uint32_t;
+
+  //! Fraction of a fixed interval accumulated but not simulated yet, in
+  //! `[0, 1]`, to interpolate between the last two fixed updates.
+  [[nodiscard]] auto Alpha() const noexcept -> float;
+
+  [[nodiscard]] auto Interval() const noexcept -> Duration {
+    return props_.interval;
+  }
+
+  [[nodiscard]] auto GetStats() const noexcept -> const Stats & {
+    return stats_;
+  }
+
+private:
+  Properties props_;
+  Duration accumulator_{};
+  Stats stats_{};
+};
+
+} // namespace oxygen::core
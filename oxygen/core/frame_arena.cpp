@@ -0,0 +1,108 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "oxygen/core/frame_arena.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "oxygen/logging/logging.h"
+
+using oxygen::core::FrameArena;
+
+namespace {
+auto &core_logger = // NOLINT(*-avoid-non-const-global-variables)
+    oxygen::log::Registry::Instance().GetLogger("Oxygen.Engine.Core");
+
+// Alignment of the arena blocks, enough for cache line aligned data.
+constexpr size_t kBlockAlignment = 64;
+} // namespace
+
+FrameArena::FrameArena(
+    const size_t capacity, std::pmr::memory_resource *upstream)
+    : buffers_{{capacity, upstream}, {capacity, upstream}} {
+}
+
+void FrameArena::NextFrame() {
+  current_ = 1 - current_;
+  buffers_[current_].Reset();
+}
+
+FrameArena::Buffer::Buffer(
+    const size_t capacity, std::pmr::memory_resource *upstream)
+    : upstream_(upstream), capacity_(capacity) {
+  if (capacity_ != 0) {
+    block_ = static_cast<std::byte *>(
+        upstream_->allocate(capacity_, kBlockAlignment));
+  }
+}
+
+FrameArena::Buffer::~Buffer() {
+  Reset();
+  if (block_ != nullptr) {
+    upstream_->deallocate(block_, capacity_, kBlockAlignment);
+  }
+}
+
+void FrameArena::Buffer::Reset() {
+  const auto used = offset_.load(std::memory_order_relaxed);
+  for (const auto &overflow : overflows_) {
+    upstream_->deallocate(overflow.ptr, overflow.bytes, overflow.alignment);
+  }
+  overflows_.clear();
+
+  if (overflow_bytes_ != 0) {
+    // Grow the block to fit the whole frame, with some headroom, so that the
+    // next frames do not overflow again.
+    const auto new_capacity =
+        std::max(capacity_ * 2, (used + overflow_bytes_) * 3 / 2);
+    ASLOG_TO_LOGGER(core_logger, info,
+        "Frame arena overflowed by {} bytes, growing from {} to {} bytes",
+        overflow_bytes_, capacity_, new_capacity);
+    if (block_ != nullptr) {
+      upstream_->deallocate(block_, capacity_, kBlockAlignment);
+    }
+    capacity_ = new_capacity;
+    block_ = static_cast<std::byte *>(
+        upstream_->allocate(capacity_, kBlockAlignment));
+    overflow_bytes_ = 0;
+  }
+  offset_.store(0, std::memory_order_relaxed);
+}
+
+auto FrameArena::Buffer::do_allocate(const size_t bytes, const size_t alignment)
+    -> void * {
+  const auto base = reinterpret_cast<std::uintptr_t>(block_);
+  auto offset = offset_.load(std::memory_order_relaxed);
+  while (true) {
+    const auto aligned =
+        ((base + offset + alignment - 1) & ~(alignment - 1)) - base;
+    const auto end = aligned + bytes;
+    if (end > capacity_) {
+      break;
+    }
+    if (offset_.compare_exchange_weak(offset, end, std::memory_order_relaxed)) {
+      return block_ + aligned;
+    }
+  }
+
+  std::lock_guard lock(overflow_mutex_);
+  auto *ptr = upstream_->allocate(bytes, alignment);
+  overflows_.push_back(
+      Overflow{.ptr = ptr, .bytes = bytes, .alignment = alignment});
+  overflow_bytes_ += bytes;
+  return ptr;
+}
+
+void FrameArena::Buffer::do_deallocate(void * /*ptr*/, size_t /*bytes*/,
+    size_t /*alignment*/) {
+  // Memory is reclaimed all at once, at the frame boundary.
+}
+
+auto FrameArena::Buffer::do_is_equal(
+    const memory_resource &other) const noexcept -> bool {
+  return this == &other;
+}
@@ -0,0 +1,109 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+#include "oxygen/base/macros.h"
+
+namespace oxygen::core {
+
+/*!
+ Linear allocator for the transient allocations of a frame.
+
+ Memory is allocated by bumping an offset in a pre-allocated block, and is
+ never released individually: deallocation is a no-op and all the memory of a
+ frame is reclaimed at once when the arena moves to the next frame. The arena
+ is double buffered, so that the data allocated during a frame stays valid
+ and readable during the whole next frame.
+
+ Allocations that do not fit in the block are served by the upstream resource
+ and, when the frame memory is reclaimed, the block is grown to fit the whole
+ frame. After a few frames, the arena no longer needs the upstream resource at
+ all.
+
+ Allocation is thread-safe, as long as it does not happen concurrently with
+ `NextFrame()`.
+*/
+class FrameArena {
+public:
+  explicit FrameArena(size_t capacity,
+      std::pmr::memory_resource *upstream = std::pmr::new_delete_resource());
+  ~FrameArena() = default;
+
+  OXYGEN_MAKE_NON_COPYABLE(FrameArena)
+  OXYGEN_MAKE_NON_MOVEABLE(FrameArena)
+
+  //! Memory resource for the allocations of the current frame.
+  [[nodiscard]] auto Resource() noexcept -> std::pmr::memory_resource & {
+    return buffers_[current_];
+  }
+
+  //! Reclaim the memory allocated two frames ago and make it the memory of the
+  //! new current frame. Must be called at the frame boundary, while nothing
+  //! allocates from the arena.
+  void NextFrame();
+
+  //! Bytes allocated from the block of the current frame.
+  [[nodiscard]] auto BytesUsed() const noexcept -> size_t {
+    return buffers_[current_].BytesUsed();
+  }
+
+  //! Size of the block of the current frame.
+  [[nodiscard]] auto Capacity() const noexcept -> size_t {
+    return buffers_[current_].Capacity();
+  }
+
+private:
+  class Buffer final : public std::pmr::memory_resource {
+  public:
+    Buffer(size_t capacity, std::pmr::memory_resource *upstream);
+    ~Buffer() override;
+
+    OXYGEN_MAKE_NON_COPYABLE(Buffer)
+    OXYGEN_MAKE_NON_MOVEABLE(Buffer)
+
+    void Reset();
+
+    [[nodiscard]] auto BytesUsed() const noexcept -> size_t {
+      return offset_.load(std::memory_order_relaxed);
+    }
+    [[nodiscard]] auto Capacity() const noexcept -> size_t {
+      return capacity_;
+    }
+
+  private:
+    auto do_allocate(size_t bytes, size_t alignment) -> void * override;
+    void do_deallocate(void *ptr, size_t bytes, size_t alignment) override;
+    [[nodiscard]] auto do_is_equal(
+        const memory_resource &other) const noexcept -> bool override;
+
+    struct Overflow {
+      void *ptr;
+      size_t bytes;
+      size_t alignment;
+    };
+
+    std::pmr::memory_resource *upstream_;
+    std::byte *block_{nullptr};
+    size_t capacity_{0};
+    std::atomic<size_t> offset_{0};
+
+    std::mutex overflow_mutex_;
+    std::vector<Overflow> overflows_;
+    size_t overflow_bytes_{0};
+  };
+
+  Buffer buffers_[2];
+  size_t current_{0};
+};
+
+} // namespace oxygen::core
@@ -0,0 +1,113 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "oxygen/core/frame_pacer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#include "oxygen/base/time.h"
+
+using oxygen::core::FramePacer;
+
+namespace {
+// Initial estimate of the sleep overshoot, before any measurement. It is
+// refined after the first sleeps.
+constexpr oxygen::Duration kInitialSleepOvershoot{1'000};
+
+// The overshoot estimate immediately follows increases, to avoid late frames,
+// but only slowly decays, by this fraction of the difference, so that an
+// occasional quick wake up does not make the next sleeps too long.
+constexpr int kOvershootDecay = 64;
+
+constexpr float kMicroSecondsInSecond = 1'000'000.0F;
+} // namespace
+
+FramePacer::FramePacer(const float target_fps)
+    : sleep_overshoot_(kInitialSleepOvershoot) {
+  SetTargetFps(target_fps);
+  Reset();
+}
+
+void FramePacer::SetTargetFps(const float target_fps) {
+  target_frame_time_ = FrameTimeFor(target_fps);
+}
+
+auto FramePacer::FrameTimeFor(const float target_fps) noexcept -> Duration {
+  return target_fps > 0.0F ? Duration(static_cast<Duration::rep>(
+                                 kMicroSecondsInSecond / target_fps))
+                           : Duration::zero();
+}
+
+void FramePacer::Reset() {
+  last_frame_end_ = Time::Now();
+  next_deadline_ = last_frame_end_;
+  frame_count_ = 0;
+}
+
+void FramePacer::EndFrame() {
+  if (target_frame_time_ != Duration::zero()) {
+    next_deadline_ += target_frame_time_;
+    const auto now = Time::Now();
+    if (next_deadline_ < now) {
+      next_deadline_ = now;
+    } else {
+      WaitUntil(next_deadline_);
+    }
+  }
+
+  const auto now = Time::Now();
+  frame_times_[frame_count_ % kStatsWindow] = now - last_frame_end_;
+  ++frame_count_;
+  last_frame_end_ = now;
+}
+
+void FramePacer::WaitUntil(const TimePoint deadline) {
+  while (true) {
+    const auto before = Time::Now();
+    const auto remaining = deadline - before;
+    if (remaining <= sleep_overshoot_) {
+      break;
+    }
+    const auto requested = remaining - sleep_overshoot_;
+    std::this_thread::sleep_for(requested);
+    const auto overshoot = Time::Now() - before - requested;
+    if (overshoot > sleep_overshoot_) {
+      sleep_overshoot_ = overshoot;
+    } else {
+      sleep_overshoot_ -= (sleep_overshoot_ - overshoot) / kOvershootDecay;
+    }
+  }
+  while (Time::Now() < deadline) {
+    std::this_thread::yield();
+  }
+}
+
+auto FramePacer::GetStats() const -> Stats {
+  const auto count = std::min(frame_count_, kStatsWindow);
+  if (count == 0) {
+    return {};
+  }
+
+  Stats stats{};
+  Duration total{};
+  for (size_t index = 0; index < count; ++index) {
+    total += frame_times_[index];
+    stats.max_frame_time = std::max(stats.max_frame_time, frame_times_[index]);
+  }
+  stats.average_frame_time = total / count;
+
+  double variance{0.0};
+  for (size_t index = 0; index < count; ++index) {
+    const auto deviation = static_cast<double>(
+        (frame_times_[index] - stats.average_frame_time).count());
+    variance += deviation * deviation;
+  }
+  variance /= static_cast<double>(count);
+  stats.jitter = Duration(static_cast<Duration::rep>(std::sqrt(variance)));
+  return stats;
+}
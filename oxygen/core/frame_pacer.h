@@ -0,0 +1,88 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "oxygen/base/types.h"
+
+namespace oxygen::core {
+
+/*!
+ Limits the frame rate of the engine loop, and measures the regularity of the
+ frames.
+
+ Waiting for the next frame is done in two phases: the thread sleeps until
+ shortly before the deadline, then spins until the deadline. Sleeping saves
+ CPU time and power, but the OS scheduler may wake the thread up late, by up
+ to its timer granularity. The spinning phase covers that granularity, which
+ the pacer calibrates continuously by measuring how late its sleeps end, so
+ that frames start on time without burning a whole core.
+
+ When a frame is late, the next one is scheduled from the end of the late
+ frame, rather than rushing to catch up with the missed deadlines.
+*/
+class FramePacer {
+public:
+  //! Number of recent frames used to compute the statistics.
+  static constexpr size_t kStatsWindow = 120;
+
+  struct Stats {
+    Duration average_frame_time{};
+    //! Standard deviation of the frame time.
+    Duration jitter{};
+    Duration max_frame_time{};
+  };
+
+  //! A `target_fps` of `0` leaves the frame rate unlimited.
+  explicit FramePacer(float target_fps = 0.0F);
+
+  void SetTargetFps(float target_fps);
+
+  //! Duration of a frame at `target_fps`, zero for an unlimited rate.
+  [[nodiscard]] static auto FrameTimeFor(float target_fps) noexcept
+      -> Duration;
+
+  //! Duration of a frame at the target frame rate, zero when unlimited.
+  [[nodiscard]] auto TargetFrameTime() const noexcept -> Duration {
+    return target_frame_time_;
+  }
+
+  //! When the next frame is due, only meaningful with a target frame rate.
+  [[nodiscard]] auto NextFrameDeadline() const noexcept -> TimePoint {
+    return next_deadline_ + target_frame_time_;
+  }
+
+  //! Start pacing the frames from now.
+  void Reset();
+
+  //! Wait until the next frame is due, and record the duration of the frame
+  //! that just ended.
+  void EndFrame();
+
+  //! Statistics of the last `kStatsWindow` frames.
+  [[nodiscard]] auto GetStats() const -> Stats;
+
+  //! Current estimate of how late a sleep can end, covered by spinning.
+  [[nodiscard]] auto SleepOvershoot() const noexcept -> Duration {
+    return sleep_overshoot_;
+  }
+
+private:
+  void WaitUntil(TimePoint deadline);
+
+  Duration target_frame_time_{};
+  TimePoint next_deadline_{};
+  TimePoint last_frame_end_{};
+  Duration sleep_overshoot_;
+
+  std::array<Duration, kStatsWindow> frame_times_{};
+  size_t frame_count_{0};
+};
+
+} // namespace oxygen::core
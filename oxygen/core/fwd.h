@@ -14,6 +14,7 @@ namespace core {
 
 class Module;
 class InputHandler;
+class JobSystem;
 class System;
 
 } // namespace core
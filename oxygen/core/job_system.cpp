@@ -0,0 +1,322 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "oxygen/core/job_system.h"
+
+#include <cassert>
+
+#include "oxygen/base/platform.h"
+#include "oxygen/logging/logging.h"
+
+#if defined(OXYGEN_WINDOWS)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(OXYGEN_LINUX)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using oxygen::core::JobCounter;
+using oxygen::core::JobHandle;
+using oxygen::core::JobSystem;
+
+namespace {
+auto &core_logger = // NOLINT(*-avoid-non-const-global-variables)
+    oxygen::log::Registry::Instance().GetLogger("Oxygen.Engine.Core");
+
+// Identifies the job system and the worker index of the calling thread, if it
+// is a worker thread.
+thread_local const JobSystem *tls_job_system{nullptr};
+thread_local size_t tls_worker_index{JobSystem::kAnyWorker};
+
+// Number of busy spins of an idle worker before it goes to sleep. Spinning a
+// little avoids the cost of a sleep / wake up cycle when jobs are scheduled in
+// quick succession, which is the common case in a frame.
+constexpr int kIdleSpins = 64;
+
+void PinThreadToCore(std::thread &thread, const size_t core) {
+#if defined(OXYGEN_WINDOWS)
+  const auto mask = DWORD_PTR{1} << core;
+  if (SetThreadAffinityMask(thread.native_handle(), mask) == 0) {
+    ASLOG_TO_LOGGER(core_logger, warn, "Could not pin worker thread to core {}",
+        core);
+  }
+#elif defined(OXYGEN_LINUX)
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  CPU_SET(core, &cpu_set);
+  if (pthread_setaffinity_np(
+          thread.native_handle(), sizeof(cpu_set), &cpu_set) != 0) {
+    ASLOG_TO_LOGGER(core_logger, warn, "Could not pin worker thread to core {}",
+        core);
+  }
+#else
+  (void)thread;
+  ASLOG_TO_LOGGER(core_logger, warn,
+      "Pinning worker threads is not supported on this platform (core {})",
+      core);
+#endif
+}
+} // namespace
+
+JobSystem::JobSystem() : JobSystem(Properties{}) {
+}
+
+JobSystem::JobSystem(const Properties props) {
+  const size_t hardware_threads =
+      std::max(std::thread::hardware_concurrency(), 1U);
+  const size_t worker_count = props.worker_count != 0
+                                  ? props.worker_count
+                                  : std::max<size_t>(hardware_threads - 1, 1);
+
+  // All workers must exist before any of them starts stealing.
+  workers_.reserve(worker_count);
+  for (size_t index = 0; index < worker_count; ++index) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  for (size_t index = 0; index < worker_count; ++index) {
+    auto &thread = workers_[index]->thread;
+    thread = std::thread([this, index]() { WorkerMain(index); });
+    if (props.pin_workers) {
+      PinThreadToCore(thread, (index + 1) % hardware_threads);
+    }
+  }
+
+  ASLOG_TO_LOGGER(
+      core_logger, info, "Job system started with {} workers", worker_count);
+}
+
+JobSystem::~JobSystem() {
+  // Workers complete all the queued jobs before they exit.
+  {
+    std::lock_guard lock(sleep_mutex_);
+    stopping_.store(true);
+  }
+  wake_up_.notify_all();
+  for (const auto &worker : workers_) {
+    if (worker->thread.joinable()) {
+      worker->thread.join();
+    }
+  }
+  ASLOG_TO_LOGGER(core_logger, info, "Job system stopped");
+}
+
+auto JobSystem::CurrentWorker() const noexcept -> size_t {
+  return tls_job_system == this ? tls_worker_index : kAnyWorker;
+}
+
+auto JobSystem::Schedule(Job job, const size_t worker_hint) -> JobHandle {
+  auto counter = std::make_shared<JobCounter>();
+  counter->pending_.store(1, std::memory_order_relaxed);
+  Push(
+      Entry{
+          .job = std::move(job),
+          .counter = counter.get(),
+          .owned_counter = counter,
+      },
+      worker_hint);
+  return JobHandle(std::move(counter));
+}
+
+void JobSystem::Schedule(
+    Job job, JobCounter &counter, const size_t worker_hint) {
+  counter.pending_.fetch_add(1, std::memory_order_relaxed);
+  Push(
+      Entry{
+          .job = std::move(job),
+          .counter = &counter,
+          .owned_counter = {},
+      },
+      worker_hint);
+}
+
+auto JobSystem::ScheduleBackground(Job job) -> JobHandle {
+  auto counter = std::make_shared<JobCounter>();
+  counter->pending_.store(1, std::memory_order_relaxed);
+  // Same ordering as in `Push()`.
+  queued_.fetch_add(1);
+  {
+    std::lock_guard lock(background_mutex_);
+    background_.push_back(Entry{
+        .job = std::move(job),
+        .counter = counter.get(),
+        .owned_counter = counter,
+    });
+  }
+  if (sleeping_.load() != 0) {
+    { std::lock_guard lock(sleep_mutex_); }
+    wake_up_.notify_one();
+  }
+  return JobHandle(std::move(counter));
+}
+
+void JobSystem::Wait(const JobCounter &counter) {
+  const auto worker_index = CurrentWorker();
+  while (!counter.IsDone()) {
+    if (!TryRunOne(worker_index)) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+void JobSystem::Wait(const JobHandle &handle) {
+  if (handle.counter_) {
+    Wait(*handle.counter_);
+  }
+}
+
+void JobSystem::ParallelForChunks(const size_t begin, const size_t end,
+    size_t grain, const std::function<void(size_t, size_t)> &body) {
+  if (begin >= end) {
+    return;
+  }
+  const size_t count = end - begin;
+  if (grain == 0) {
+    // A few chunks per thread, including the calling one, to balance uneven
+    // work between the chunks.
+    constexpr size_t kChunksPerThread = 4;
+    grain = std::max<size_t>(
+        count / ((WorkerCount() + 1) * kChunksPerThread), size_t{1});
+  }
+
+  JobCounter counter;
+  for (size_t chunk_begin = begin + grain; chunk_begin < end;
+       chunk_begin += grain) {
+    const size_t chunk_end = std::min(chunk_begin + grain, end);
+    Schedule(
+        [&body, chunk_begin, chunk_end]() { body(chunk_begin, chunk_end); },
+        counter);
+  }
+  // The calling thread takes the first chunk, then helps with the rest.
+  body(begin, std::min(begin + grain, end));
+  Wait(counter);
+}
+
+void JobSystem::Push(Entry entry, const size_t worker_hint) {
+  assert(!workers_.empty());
+  size_t worker_index = worker_hint;
+  if (worker_index == kAnyWorker) {
+    worker_index = CurrentWorker();
+  }
+  if (worker_index == kAnyWorker) {
+    worker_index = next_worker_.fetch_add(1, std::memory_order_relaxed);
+  }
+  worker_index %= workers_.size();
+
+  // Counted before it is pushed, so that the count never goes below the
+  // number of jobs that can be popped. Sequentially consistent operations on
+  // `queued_` and `sleeping_` guarantee that either a sleeping worker is seen
+  // below, or the worker sees the new job before going to sleep.
+  queued_.fetch_add(1);
+  {
+    auto &worker = *workers_[worker_index];
+    std::lock_guard lock(worker.mutex);
+    worker.queue.push_back(std::move(entry));
+  }
+  if (sleeping_.load() != 0) {
+    { std::lock_guard lock(sleep_mutex_); }
+    wake_up_.notify_one();
+  }
+}
+
+auto JobSystem::PopOwn(Worker &worker, Entry &entry) -> bool {
+  std::lock_guard lock(worker.mutex);
+  if (worker.queue.empty()) {
+    return false;
+  }
+  entry = std::move(worker.queue.back());
+  worker.queue.pop_back();
+  return true;
+}
+
+auto JobSystem::Steal(Worker &victim, Entry &entry) -> bool {
+  std::unique_lock lock(victim.mutex, std::try_to_lock);
+  if (!lock.owns_lock() || victim.queue.empty()) {
+    return false;
+  }
+  entry = std::move(victim.queue.front());
+  victim.queue.pop_front();
+  return true;
+}
+
+auto JobSystem::PopBackground(Entry &entry) -> bool {
+  std::lock_guard lock(background_mutex_);
+  if (background_.empty()) {
+    return false;
+  }
+  entry = std::move(background_.front());
+  background_.pop_front();
+  return true;
+}
+
+auto JobSystem::TryRunOne(const size_t worker_index) -> bool {
+  if (queued_.load(std::memory_order_relaxed) == 0) {
+    return false;
+  }
+
+  Entry entry;
+  bool found =
+      worker_index != kAnyWorker && PopOwn(*workers_[worker_index], entry);
+  if (!found) {
+    // Start stealing from the next worker, to spread the thieves.
+    const size_t first = worker_index == kAnyWorker ? 0 : worker_index + 1;
+    for (size_t offset = 0; offset < workers_.size() && !found; ++offset) {
+      const size_t victim = (first + offset) % workers_.size();
+      if (victim != worker_index) {
+        found = Steal(*workers_[victim], entry);
+      }
+    }
+  }
+  // Background jobs last, and never on a thread that is not a worker.
+  if (!found && worker_index != kAnyWorker) {
+    found = PopBackground(entry);
+  }
+  if (!found) {
+    return false;
+  }
+
+  queued_.fetch_sub(1);
+  entry.job();
+  entry.counter->pending_.fetch_sub(1, std::memory_order_release);
+  return true;
+}
+
+void JobSystem::WorkerMain(const size_t worker_index) {
+  tls_job_system = this;
+  tls_worker_index = worker_index;
+
+  int idle_spins = 0;
+  while (true) {
+    if (TryRunOne(worker_index)) {
+      idle_spins = 0;
+      continue;
+    }
+    if (stopping_.load() && queued_.load() == 0) {
+      break;
+    }
+    if (++idle_spins < kIdleSpins) {
+      std::this_thread::yield();
+      continue;
+    }
+    idle_spins = 0;
+
+    sleeping_.fetch_add(1);
+    {
+      std::unique_lock lock(sleep_mutex_);
+      wake_up_.wait(
+          lock, [this]() { return queued_.load() != 0 || stopping_.load(); });
+    }
+    sleeping_.fetch_sub(1);
+  }
+
+  tls_job_system = nullptr;
+  tls_worker_index = kAnyWorker;
+}
@@ -0,0 +1,214 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "oxygen/base/macros.h"
+
+namespace oxygen::core {
+
+/*!
+ Number of jobs scheduled against it and not completed yet.
+
+ A counter is owned by the code scheduling the jobs, which must keep it alive
+ until it is done. Any number of jobs can be scheduled against the same
+ counter, which can then be used to wait for all of them at once.
+*/
+class JobCounter {
+public:
+  JobCounter() = default;
+  ~JobCounter() = default;
+
+  OXYGEN_MAKE_NON_COPYABLE(JobCounter)
+  OXYGEN_MAKE_NON_MOVEABLE(JobCounter)
+
+  [[nodiscard]] auto IsDone() const noexcept -> bool {
+    return pending_.load(std::memory_order_acquire) == 0;
+  }
+
+  [[nodiscard]] auto Pending() const noexcept -> uint32_t {
+    return pending_.load(std::memory_order_acquire);
+  }
+
+private:
+  friend class JobSystem;
+  std::atomic<uint32_t> pending_{0};
+};
+
+/*!
+ Handle to a single scheduled job, which shares the ownership of its counter
+ with the job system. A default constructed handle refers to no job and is
+ always done.
+*/
+class JobHandle {
+public:
+  JobHandle() = default;
+
+  [[nodiscard]] auto IsValid() const noexcept -> bool {
+    return counter_ != nullptr;
+  }
+
+  [[nodiscard]] auto IsDone() const noexcept -> bool {
+    return !counter_ || counter_->IsDone();
+  }
+
+private:
+  friend class JobSystem;
+  explicit JobHandle(std::shared_ptr<JobCounter> counter)
+      : counter_(std::move(counter)) {
+  }
+
+  std::shared_ptr<JobCounter> counter_;
+};
+
+/*!
+ Pool of worker threads executing jobs, with one work-stealing queue per
+ worker.
+
+ A worker pushes the jobs it schedules to the back of its own queue and takes
+ its next job from the back too, which keeps the recently produced data hot in
+ its cache. An idle worker steals from the front of the other queues, which
+ takes the oldest, and usually the biggest, pending work. Jobs scheduled from a
+ thread that is not a worker are distributed over the workers in round robin.
+
+ Waiting on a counter never blocks the waiting thread while there is work
+ pending: it executes pending jobs until the counter is done. This makes it
+ safe to schedule and wait for jobs from within jobs. Background jobs are the
+ exception, they only run on the workers, see `ScheduleBackground()`.
+
+ Jobs must not throw; an exception escaping a job terminates the program.
+*/
+class JobSystem {
+public:
+  using Job = std::function<void()>;
+
+  //! Worker hint meaning that the job can run on any worker.
+  static constexpr size_t kAnyWorker = std::numeric_limits<size_t>::max();
+
+  struct Properties {
+    //! Number of worker threads. The default, `0`, creates one worker per
+    //! hardware thread, minus one for the main thread.
+    size_t worker_count{0};
+    //! When `true`, each worker thread is pinned to its own core, leaving the
+    //! first core to the main thread.
+    bool pin_workers{false};
+  };
+
+  JobSystem();
+  explicit JobSystem(Properties props);
+  ~JobSystem();
+
+  OXYGEN_MAKE_NON_COPYABLE(JobSystem)
+  OXYGEN_MAKE_NON_MOVEABLE(JobSystem)
+
+  [[nodiscard]] auto WorkerCount() const noexcept -> size_t {
+    return workers_.size();
+  }
+
+  //! Index of the worker running the calling thread in this job system, or
+  //! `kAnyWorker` when called from a thread that is not one of its workers.
+  [[nodiscard]] auto CurrentWorker() const noexcept -> size_t;
+
+  /*!
+   Schedule a job, optionally with a hint for the worker that should run it.
+   The hint only selects the queue in which the job is placed. Other workers
+   may still steal the job when they run out of work, so it must not be
+   relied upon for correctness.
+  */
+  auto Schedule(Job job, size_t worker_hint = kAnyWorker) -> JobHandle;
+  void Schedule(Job job, JobCounter &counter, size_t worker_hint = kAnyWorker);
+
+  /*!
+   Schedule a long job, such as a module initialization, that only runs on the
+   workers, and only when they have no other job. A thread that is not a
+   worker never runs it while waiting, so that waiting for a short job, for
+   example from the main thread during a frame, cannot end up running it.
+  */
+  auto ScheduleBackground(Job job) -> JobHandle;
+
+  void Wait(const JobCounter &counter);
+  void Wait(const JobHandle &handle);
+
+  /*!
+   Call `fn(index)` for each index in `[begin, end)`, splitting the range in
+   chunks of `grain` indices executed in parallel, and return once all of them
+   have completed. The calling thread executes chunks too. With the default
+   `grain` of `0`, the range is split in a few chunks per worker.
+  */
+  template <typename Fn>
+  void ParallelFor(size_t begin, size_t end, Fn &&fn, size_t grain = 0) {
+    ParallelForChunks(begin, end, grain,
+        [&fn](const size_t chunk_begin, const size_t chunk_end) {
+          for (size_t index = chunk_begin; index < chunk_end; ++index) {
+            fn(index);
+          }
+        });
+  }
+
+  //! Call `fn(item)` for each item in `items`, in parallel.
+  template <typename T, typename Fn>
+  void ParallelFor(std::span<T> items, Fn &&fn, size_t grain = 0) {
+    ParallelForChunks(0, items.size(), grain,
+        [&items, &fn](const size_t chunk_begin, const size_t chunk_end) {
+          for (size_t index = chunk_begin; index < chunk_end; ++index) {
+            fn(items[index]);
+          }
+        });
+  }
+
+private:
+  struct Entry {
+    Job job;
+    JobCounter *counter{nullptr};
+    // Keeps the counter of a job scheduled through a JobHandle alive.
+    std::shared_ptr<JobCounter> owned_counter;
+  };
+
+  struct Worker {
+    std::mutex mutex;
+    std::deque<Entry> queue;
+    std::thread thread;
+  };
+
+  void ParallelForChunks(size_t begin, size_t end, size_t grain,
+      const std::function<void(size_t, size_t)> &body);
+
+  void Push(Entry entry, size_t worker_hint);
+  auto TryRunOne(size_t worker_index) -> bool;
+  auto PopOwn(Worker &worker, Entry &entry) -> bool;
+  auto Steal(Worker &victim, Entry &entry) -> bool;
+  auto PopBackground(Entry &entry) -> bool;
+  void WorkerMain(size_t worker_index);
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  // Shared by all the workers, in the order they were scheduled.
+  std::mutex background_mutex_;
+  std::deque<Entry> background_;
+
+  // Number of jobs sitting in the queues, background ones included, used to
+  // put idle workers to sleep and to wake them up.
+  std::atomic<size_t> queued_{0};
+  std::atomic<size_t> sleeping_{0};
+  std::atomic<bool> stopping_{false};
+  std::atomic<size_t> next_worker_{0};
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_up_;
+};
+
+} // namespace oxygen::core
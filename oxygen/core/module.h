@@ -8,9 +8,47 @@
 
 #include "oxygen/base/time.h"
 #include "oxygen/platform/fwd.h"
+#include "oxygen/platform/input_event.h"
+
+#include <cstdint>
+#include <memory>
 
 namespace oxygen::core {
 
+//! Immutable snapshot of what a module needs to render one frame, published
+//! by the module at the end of its update in pipelined mode.
+class FramePacket {
+public:
+  FramePacket() = default;
+  virtual ~FramePacket() = default;
+
+  FramePacket(const FramePacket &) = default;
+  auto operator=(const FramePacket &) -> FramePacket & = default;
+  FramePacket(FramePacket &&other) noexcept = default;
+  auto operator=(FramePacket &&other) noexcept -> FramePacket & = default;
+};
+
+//! The input events a module receives, see `Module::GetInputInterest()`.
+struct InputInterest {
+  // One bit per `platform::InputEventType`, see `Bit()`.
+  uint32_t event_types{~0U};
+  // Only the events of this window, or of all windows when invalid.
+  platform::WindowIdType window_id{platform::kInvalidWindowId};
+
+  [[nodiscard]] static constexpr auto Bit(platform::InputEventType type)
+      -> uint32_t {
+    return 1U << static_cast<uint32_t>(type);
+  }
+  [[nodiscard]] static constexpr auto None() -> InputInterest {
+    return {.event_types = 0U};
+  }
+
+  [[nodiscard]] constexpr auto Wants(platform::InputEventType type) const
+      -> bool {
+    return (event_types & Bit(type)) != 0U;
+  }
+};
+
 class Module {
 public:
   Module() = default;
@@ -24,13 +62,38 @@ public:
   Module(Module &&other) noexcept = delete;
   auto operator=(Module &&other) noexcept -> Module & = delete;
 
+  // Called once, before the module takes part in the frames. Initializations
+  // run in parallel, on the job system, unless the module requires the main
+  // thread, which is the default as windows and graphics APIs usually do.
+  // See `Engine::ModuleOptions` for the ordering of the initializations.
   virtual auto Initialize() -> void = 0;
+  [[nodiscard]] virtual auto InitializesOnMainThread() const -> bool {
+    return true;
+  }
 
+  // Queried once, after the initialization of the module, for the engine to
+  // only dispatch the events the module is interested in to `ProcessInput()`.
+  [[nodiscard]] virtual auto GetInputInterest() const -> InputInterest {
+    return {};
+  }
   virtual auto ProcessInput(const platform::InputEvent &event) -> void = 0;
-  virtual auto Update(Duration delta_time) -> void = 0;
+  // `fixed_alpha` is the fraction of a fixed interval elapsed since the last
+  // fixed update, to interpolate the state of the last two fixed updates.
+  virtual auto Update(Duration delta_time, float fixed_alpha) -> void = 0;
   virtual auto FixedUpdate() -> void = 0;
   virtual auto Render() -> void = 0;
 
+  // Pipelined mode, see `Engine::Properties::pipeline_depth`. The update then
+  // runs on a job system thread, concurrently with the rendering of a previous
+  // frame from its packet, so the packet must hold everything the rendering
+  // reads. Modules that do not publish packets are rendered with `Render()`,
+  // once their update has completed.
+  virtual auto PublishFramePacket() -> std::unique_ptr<const FramePacket> {
+    return nullptr;
+  }
+  virtual auto RenderFramePacket(const FramePacket & /*packet*/) -> void {
+  }
+
   virtual auto Shutdown() noexcept -> void = 0;
 };
 
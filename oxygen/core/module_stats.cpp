@@ -0,0 +1,58 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "oxygen/core/module_stats.h"
+
+#include <algorithm>
+
+using oxygen::core::ModulePhase;
+using oxygen::core::ModuleStats;
+using oxygen::core::ModuleTimings;
+
+auto oxygen::core::to_string(const ModulePhase phase) -> const char * {
+  switch (phase) {
+  case ModulePhase::kProcessInput:
+    return "ProcessInput";
+  case ModulePhase::kFixedUpdate:
+    return "FixedUpdate";
+  case ModulePhase::kUpdate:
+    return "Update";
+  case ModulePhase::kRender:
+    return "Render";
+  case ModulePhase::kCount:
+    break;
+  }
+  return "Unknown";
+}
+
+void ModuleStats::EndFrame() noexcept {
+  const auto slot = frames_ % kWindow;
+  for (size_t phase = 0; phase < kPhaseCount; ++phase) {
+    history_[phase][slot] = current_[phase];
+    current_[phase] = Duration::zero();
+  }
+  ++frames_;
+}
+
+auto ModuleStats::Timings() const noexcept -> ModuleTimings {
+  ModuleTimings timings{};
+  const auto count = std::min(frames_, kWindow);
+  if (count == 0) {
+    return timings;
+  }
+  const auto last_slot = (frames_ - 1) % kWindow;
+  for (size_t phase = 0; phase < kPhaseCount; ++phase) {
+    auto &timing = timings.phases[phase];
+    Duration total{};
+    for (size_t slot = 0; slot < count; ++slot) {
+      total += history_[phase][slot];
+      timing.max = std::max(timing.max, history_[phase][slot]);
+    }
+    timing.average = total / count;
+    timing.last = history_[phase][last_slot];
+  }
+  return timings;
+}
@@ -0,0 +1,76 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "oxygen/base/types.h"
+
+namespace oxygen::core {
+
+enum class ModulePhase : uint8_t {
+  kProcessInput,
+  kFixedUpdate,
+  kUpdate,
+  kRender,
+
+  kCount // Not a phase, the number of phases
+};
+
+auto to_string(ModulePhase phase) -> const char *;
+
+struct PhaseTiming {
+  Duration last{};
+  Duration average{};
+  Duration max{};
+};
+
+struct ModuleTimings {
+  // Indexed by `ModulePhase`, over the recent frames.
+  std::array<PhaseTiming, static_cast<size_t>(ModulePhase::kCount)> phases{};
+  uint32_t fps{0};
+  uint32_t ups{0};
+
+  [[nodiscard]] auto operator[](ModulePhase phase) const
+      -> const PhaseTiming & {
+    return phases[static_cast<size_t>(phase)];
+  }
+};
+
+/*!
+ Time spent by a module in each phase of the recent frames.
+
+ The time of a phase is accumulated over the frame, as some phases run several
+ times per frame, then committed at the end of the frame in a fixed-size ring
+ buffer. Nothing is allocated after construction.
+*/
+class ModuleStats {
+public:
+  //! Number of frames kept for the statistics.
+  static constexpr size_t kWindow = 128;
+
+  void Record(ModulePhase phase, Duration duration) noexcept {
+    current_[static_cast<size_t>(phase)] += duration;
+  }
+
+  void EndFrame() noexcept;
+
+  //! Timing of each phase over the last `kWindow` frames, without the fps and
+  //! ups, which are counted by the engine.
+  [[nodiscard]] auto Timings() const noexcept -> ModuleTimings;
+
+private:
+  static constexpr auto kPhaseCount = static_cast<size_t>(ModulePhase::kCount);
+
+  std::array<Duration, kPhaseCount> current_{};
+  std::array<std::array<Duration, kWindow>, kPhaseCount> history_{};
+  size_t frames_{0};
+};
+
+} // namespace oxygen::core
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <memory_resource>
+
 #include "oxygen/base/macros.h"
 #include "oxygen/base/time.h"
 
@@ -14,6 +16,9 @@ namespace oxygen::engine {
 struct SystemUpdateContext {
   Duration time_since_start{};
   Duration delta_time{};
+  // Memory for the transient allocations of the frame, reclaimed at the end of
+  // the next frame. Falls back to the default resource when not provided.
+  std::pmr::memory_resource *frame_memory{std::pmr::get_default_resource()};
 };
 
 class System {
@@ -0,0 +1,243 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "oxygen/core/system_scheduler.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "oxygen/core/job_system.h"
+#include "oxygen/logging/logging.h"
+
+using oxygen::engine::SystemScheduler;
+
+namespace {
+auto &core_logger = // NOLINT(*-avoid-non-const-global-variables)
+    oxygen::log::Registry::Instance().GetLogger("Oxygen.Engine.Core");
+
+// Weight of the last frame in the smoothed average of a system's update time.
+constexpr int kAverageSmoothing = 16;
+
+auto Contains(const std::vector<std::string> &names, std::string_view name)
+    -> bool {
+  return std::ranges::find(names, name) != names.end();
+}
+
+auto Intersects(const std::vector<std::string> &first,
+    const std::vector<std::string> &second) -> bool {
+  return std::ranges::any_of(
+      first, [&second](const auto &name) { return Contains(second, name); });
+}
+
+auto Conflict(const oxygen::engine::SystemDescriptor &first,
+    const oxygen::engine::SystemDescriptor &second) -> bool {
+  return Intersects(first.writes, second.writes) ||
+         Intersects(first.writes, second.reads) ||
+         Intersects(first.reads, second.writes);
+}
+} // namespace
+
+SystemScheduler::SystemScheduler(core::JobSystem &job_system)
+    : job_system_(job_system) {
+}
+
+SystemScheduler::~SystemScheduler() = default;
+
+auto SystemScheduler::Register(
+    std::weak_ptr<System> system, SystemDescriptor descriptor) -> bool {
+  const auto found = std::ranges::find_if(nodes_, [&descriptor](auto &node) {
+    return node.descriptor.name == descriptor.name;
+  });
+  if (found != nodes_.end()) {
+    ASLOG_TO_LOGGER(core_logger, error,
+        "A system named `{}` is already registered", descriptor.name);
+    return false;
+  }
+  nodes_.push_back(Node{
+      .system = std::move(system),
+      .descriptor = std::move(descriptor),
+      .dependents = {},
+  });
+  dirty_ = true;
+  return true;
+}
+
+auto SystemScheduler::Unregister(std::string_view name) -> bool {
+  const auto found = std::ranges::find_if(
+      nodes_, [name](auto &node) { return node.descriptor.name == name; });
+  if (found == nodes_.end()) {
+    return false;
+  }
+  nodes_.erase(found);
+  dirty_ = true;
+  return true;
+}
+
+void SystemScheduler::Build() {
+  const auto count = nodes_.size();
+  for (auto &node : nodes_) {
+    node.dependents.clear();
+    node.dependencies_count = 0;
+  }
+  const auto add_edge = [this](const size_t from, const size_t to) {
+    auto &dependents = nodes_[from].dependents;
+    if (std::ranges::find(dependents, to) == dependents.end()) {
+      dependents.push_back(to);
+      ++nodes_[to].dependencies_count;
+    }
+  };
+
+  for (size_t index = 0; index < count; ++index) {
+    const auto &descriptor = nodes_[index].descriptor;
+    for (const auto &name : descriptor.run_after) {
+      const auto found = std::ranges::find_if(nodes_,
+          [&name](auto &node) { return node.descriptor.name == name; });
+      if (found == nodes_.end()) {
+        ASLOG_TO_LOGGER(core_logger, warn,
+            "System `{}` runs after `{}`, which is not registered",
+            descriptor.name, name);
+        continue;
+      }
+      add_edge(static_cast<size_t>(found - nodes_.begin()), index);
+    }
+  }
+  // Conflicting systems are ordered by registration, unless the graph already
+  // orders them, directly or through other systems. Edges only ever go against
+  // an existing path, so they never create a cycle.
+  std::vector<size_t> stack;
+  std::vector<bool> visited_nodes(count);
+  const auto reaches = [&](const size_t from, const size_t to) {
+    std::fill(visited_nodes.begin(), visited_nodes.end(), false);
+    stack.assign(1, from);
+    while (!stack.empty()) {
+      const auto index = stack.back();
+      stack.pop_back();
+      if (index == to) {
+        return true;
+      }
+      for (const auto dependent : nodes_[index].dependents) {
+        if (!visited_nodes[dependent]) {
+          visited_nodes[dependent] = true;
+          stack.push_back(dependent);
+        }
+      }
+    }
+    return false;
+  };
+  for (size_t later = 1; later < count; ++later) {
+    const auto &later_descriptor = nodes_[later].descriptor;
+    for (size_t earlier = 0; earlier < later; ++earlier) {
+      if (!Conflict(nodes_[earlier].descriptor, later_descriptor) ||
+          reaches(earlier, later) || reaches(later, earlier)) {
+        continue;
+      }
+      add_edge(earlier, later);
+    }
+  }
+
+  // Kahn's algorithm, only to detect cycles.
+  std::vector<size_t> remaining(count);
+  std::vector<size_t> ready;
+  for (size_t index = 0; index < count; ++index) {
+    remaining[index] = nodes_[index].dependencies_count;
+    if (remaining[index] == 0) {
+      ready.push_back(index);
+    }
+  }
+  size_t visited = 0;
+  while (!ready.empty()) {
+    const auto index = ready.back();
+    ready.pop_back();
+    ++visited;
+    for (const auto dependent : nodes_[index].dependents) {
+      if (--remaining[dependent] == 0) {
+        ready.push_back(dependent);
+      }
+    }
+  }
+  if (visited != count) {
+    ASLOG_TO_LOGGER(core_logger, error,
+        "The system dependencies contain a cycle, systems will run serially "
+        "in registration order");
+    for (size_t index = 0; index < count; ++index) {
+      nodes_[index].dependents.clear();
+      nodes_[index].dependencies_count = index == 0 ? 0 : 1;
+      if (index + 1 < count) {
+        nodes_[index].dependents.push_back(index + 1);
+      }
+    }
+  }
+
+  remaining_dependencies_ = std::make_unique<std::atomic<size_t>[]>(count);
+  timings_.clear();
+  timings_.reserve(count);
+  for (const auto &node : nodes_) {
+    timings_.push_back(SystemTiming{.name = node.descriptor.name});
+  }
+  dirty_ = false;
+
+  ASLOG_TO_LOGGER(core_logger, info, "System schedule built for {} systems",
+      nodes_.size());
+}
+
+void SystemScheduler::Update(const SystemUpdateContext &update_context) {
+  if (dirty_) {
+    Build();
+  }
+  if (nodes_.empty()) {
+    return;
+  }
+
+  for (size_t index = 0; index < nodes_.size(); ++index) {
+    remaining_dependencies_[index].store(
+        nodes_[index].dependencies_count, std::memory_order_relaxed);
+  }
+  core::JobCounter counter;
+  update_context_ = &update_context;
+  counter_ = &counter;
+  for (size_t index = 0; index < nodes_.size(); ++index) {
+    if (nodes_[index].dependencies_count == 0) {
+      Schedule(index);
+    }
+  }
+  // Dependents are scheduled by the job completing their last dependency,
+  // before that job completes, so the counter only gets to zero once all the
+  // systems have run.
+  job_system_.Wait(counter);
+  update_context_ = nullptr;
+  counter_ = nullptr;
+}
+
+void SystemScheduler::Schedule(const size_t index) {
+  job_system_.Schedule(
+      [this, index]() {
+        RunSystem(index);
+        for (const auto dependent : nodes_[index].dependents) {
+          if (remaining_dependencies_[dependent].fetch_sub(
+                  1, std::memory_order_acq_rel) == 1) {
+            Schedule(dependent);
+          }
+        }
+      },
+      *counter_);
+}
+
+void SystemScheduler::RunSystem(const size_t index) {
+  auto system = nodes_[index].system.lock();
+  if (!system) {
+    return;
+  }
+  const auto start = std::chrono::steady_clock::now();
+  system->Update(*update_context_);
+  const auto elapsed = std::chrono::duration_cast<Duration>(
+      std::chrono::steady_clock::now() - start);
+
+  // Only the job running this system writes its timing.
+  auto &timing = timings_[index];
+  timing.last = elapsed;
+  timing.average += (elapsed - timing.average) / kAverageSmoothing;
+  timing.max = std::max(timing.max, elapsed);
+}
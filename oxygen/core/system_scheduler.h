@@ -0,0 +1,116 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "oxygen/base/macros.h"
+#include "oxygen/base/types.h"
+#include "oxygen/core/system.h"
+
+namespace oxygen::core {
+class JobCounter;
+class JobSystem;
+} // namespace oxygen::core
+
+namespace oxygen::engine {
+
+struct SystemDescriptor {
+  // Unique name of the system, also used in run_after constraints.
+  std::string name{};
+
+  // Names of the data (components, resources, ...) that the system reads and
+  // writes during its update. Two systems conflict when one of them writes
+  // something the other one reads or writes.
+  std::vector<std::string> reads{};
+  std::vector<std::string> writes{};
+
+  // Names of the systems that must complete their update before this one
+  // starts.
+  std::vector<std::string> run_after{};
+};
+
+struct SystemTiming {
+  std::string name;
+  Duration last{};
+  Duration average{}; // Smoothed over the recent frames
+  Duration max{};
+};
+
+/*
+Runs the registered systems every frame, in parallel when they are
+independent.
+
+The scheduler builds a dependency graph from the systems' descriptors, once
+after each change of the registered systems. A system depends on the systems
+listed in its `run_after` constraints and, when they conflict over the data
+they access, on the systems registered before it, unless the constraints
+already order them, directly or through other systems. Every frame, systems
+whose dependencies have completed are dispatched to the job system, and
+`Update()` returns once all of them have completed.
+
+If the constraints contain a cycle, the graph cannot be built: the error is
+logged and all systems run one after the other, in registration order.
+
+Systems are held by weak pointers; a system that has been destroyed is skipped
+and should be unregistered by its owner.
+*/
+class SystemScheduler {
+public:
+  explicit SystemScheduler(core::JobSystem &job_system);
+  ~SystemScheduler();
+
+  OXYGEN_MAKE_NON_COPYABLE(SystemScheduler)
+  OXYGEN_MAKE_NON_MOVEABLE(SystemScheduler)
+
+  // Returns `false` if a system with the same name is already registered.
+  auto Register(std::weak_ptr<System> system, SystemDescriptor descriptor)
+      -> bool;
+  // Returns `false` if no system with that name is registered.
+  auto Unregister(std::string_view name) -> bool;
+
+  [[nodiscard]] auto Size() const noexcept -> size_t {
+    return nodes_.size();
+  }
+
+  void Update(const SystemUpdateContext &update_context);
+
+  // Timing of each system's last updates, in registration order.
+  [[nodiscard]] auto Timings() const -> std::span<const SystemTiming> {
+    return timings_;
+  }
+
+private:
+  struct Node {
+    std::weak_ptr<System> system;
+    SystemDescriptor descriptor;
+    std::vector<size_t> dependents;
+    size_t dependencies_count{0};
+  };
+
+  void Build();
+  void Schedule(size_t index);
+  void RunSystem(size_t index);
+
+  core::JobSystem &job_system_;
+  std::vector<Node> nodes_;
+  std::vector<SystemTiming> timings_;
+  std::unique_ptr<std::atomic<size_t>[]> remaining_dependencies_;
+  bool dirty_{false};
+
+  // State of the update in progress. Kept here rather than captured by the
+  // jobs, so that the jobs are small enough to not allocate.
+  const SystemUpdateContext *update_context_{nullptr};
+  core::JobCounter *counter_{nullptr};
+};
+
+} // namespace oxygen::engine
@@ -0,0 +1,143 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "oxygen/core/engine.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "oxygen/base/macros.h"
+#include "oxygen/base/types.h"
+#include "oxygen/core/system.h"
+#include "oxygen/core/system_scheduler.h"
+#include "oxygen/platform-null/platform.h"
+#include "oxygen/platform/window.h"
+
+using oxygen::Duration;
+using oxygen::Engine;
+using oxygen::PixelExtent;
+using oxygen::engine::System;
+using oxygen::engine::SystemUpdateContext;
+using oxygen::platform::null::Platform;
+
+using testing::IsTrue;
+using testing::Lt;
+using testing::SizeIs;
+
+namespace {
+
+// Records the frame duration seen by the systems, frame after frame.
+class FrameLog final : public System {
+public:
+  void Update(const SystemUpdateContext &update_context) override {
+    {
+      std::lock_guard lock(mutex_);
+      delta_times_.push_back(update_context.delta_time);
+    }
+    frame_done_.notify_all();
+  }
+
+  //! Block until `count` frames have run, and return their durations.
+  auto WaitForFrames(const size_t count) -> std::vector<Duration> {
+    std::unique_lock lock(mutex_);
+    frame_done_.wait(lock, [this, count]() {
+      return delta_times_.size() >= count;
+    });
+    return delta_times_;
+  }
+
+private:
+  std::mutex mutex_;
+  std::condition_variable frame_done_;
+  std::vector<Duration> delta_times_;
+};
+
+// An engine in on-demand mode on the null platform, running on its own thread
+// until its window is closed.
+class OnDemandEngine {
+public:
+  OnDemandEngine()
+      : window_(platform_
+                .MakeWindow("test", PixelExtent{.width = 800, .height = 600})
+                .lock()),
+        engine_(platform_, MakeProperties()) {
+    EXPECT_THAT(engine_.AddSystem(log_, {.name = "log"}), IsTrue());
+    thread_ = std::thread([this]() { engine_.Run(); });
+  }
+
+  ~OnDemandEngine() {
+    window_->RequestClose(true);
+    thread_.join();
+  }
+
+  OXYGEN_MAKE_NON_COPYABLE(OnDemandEngine)
+  OXYGEN_MAKE_NON_MOVEABLE(OnDemandEngine)
+
+  [[nodiscard]] auto GetEngine() -> Engine & {
+    return engine_;
+  }
+  [[nodiscard]] auto Log() -> FrameLog & {
+    return *log_;
+  }
+
+private:
+  static auto MakeProperties() -> Engine::Properties {
+    Engine::Properties props{};
+    props.worker_threads = 1;
+    props.on_demand_frames = true;
+    return props;
+  }
+
+  Platform platform_;
+  std::shared_ptr<oxygen::platform::Window> window_;
+  std::shared_ptr<FrameLog> log_{std::make_shared<FrameLog>()};
+  Engine engine_;
+  std::thread thread_;
+};
+
+constexpr auto kIdleTime = std::chrono::milliseconds(300);
+// Much shorter than the idle time, with a margin for loaded machines.
+constexpr auto kMaxFrameDuration = std::chrono::milliseconds(150);
+
+} // namespace
+
+// NOLINTNEXTLINE
+TEST(EngineTest, RequestFrameWakesUpIdleEngine) {
+  OnDemandEngine on_demand;
+  // The first frame runs without a request, then the engine waits for one
+  // without limit.
+  ASSERT_THAT(on_demand.Log().WaitForFrames(1), SizeIs(1));
+  std::this_thread::sleep_for(kIdleTime);
+
+  std::thread([&on_demand]() { on_demand.GetEngine().RequestFrame(); }).join();
+  const auto delta_times = on_demand.Log().WaitForFrames(2);
+
+  // The idle time is not part of the frame duration.
+  EXPECT_THAT(delta_times[1], Lt(kMaxFrameDuration));
+}
+
+// NOLINTNEXTLINE
+TEST(EngineTest, RequestFrameInWakesUpIdleEngine) {
+  OnDemandEngine on_demand;
+  ASSERT_THAT(on_demand.Log().WaitForFrames(1), SizeIs(1));
+  std::this_thread::sleep_for(kIdleTime);
+
+  // The engine was waiting without limit, it must now wait until the delay.
+  std::thread([&on_demand]() {
+    on_demand.GetEngine().RequestFrameIn(std::chrono::milliseconds(10));
+  }).join();
+  const auto delta_times = on_demand.Log().WaitForFrames(2);
+
+  EXPECT_THAT(delta_times[1], Lt(kMaxFrameDuration));
+}
@@ -0,0 +1,81 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "oxygen/core/fixed_step.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using oxygen::Duration;
+using oxygen::core::FixedStep;
+
+using testing::Eq;
+using testing::FloatEq;
+
+using namespace std::chrono_literals;
+
+// NOLINTNEXTLINE
+TEST(FixedStepTest, AccumulatesFrameTime) {
+  FixedStep fixed_step({.interval = 10ms});
+
+  EXPECT_THAT(fixed_step.Advance(4ms), Eq(0));
+  EXPECT_THAT(fixed_step.Alpha(), FloatEq(0.4F));
+  EXPECT_THAT(fixed_step.Advance(8ms), Eq(1));
+  EXPECT_THAT(fixed_step.Alpha(), FloatEq(0.2F));
+  EXPECT_THAT(fixed_step.Advance(25ms), Eq(2));
+  EXPECT_THAT(fixed_step.Alpha(), FloatEq(0.7F));
+
+  EXPECT_THAT(fixed_step.GetStats().frames, Eq(3));
+  EXPECT_THAT(fixed_step.GetStats().catch_up_frames, Eq(1));
+  EXPECT_THAT(fixed_step.GetStats().capped_frames, Eq(0));
+}
+
+// NOLINTNEXTLINE
+TEST(FixedStepTest, ClampsLongFrames) {
+  FixedStep fixed_step({
+      .interval = 10ms,
+      .max_frame_duration = 50ms,
+      .max_substeps = 100,
+  });
+
+  // A one second hitch only accounts for the maximum frame duration.
+  EXPECT_THAT(fixed_step.Advance(1s), Eq(5));
+  EXPECT_THAT(fixed_step.Alpha(), FloatEq(0.0F));
+}
+
+// NOLINTNEXTLINE
+TEST(FixedStepTest, DilatesTimeWhenCapped) {
+  FixedStep fixed_step({
+      .interval = 10ms,
+      .max_frame_duration = 100ms,
+      .max_substeps = 3,
+      .dilate_time = true,
+  });
+
+  EXPECT_THAT(fixed_step.Advance(55ms), Eq(3));
+  EXPECT_THAT(fixed_step.Alpha(), FloatEq(0.5F));
+  EXPECT_THAT(fixed_step.GetStats().capped_frames, Eq(1));
+  EXPECT_THAT(fixed_step.GetStats().dilated_time, Eq(Duration(20ms)));
+
+  // The dropped time is not caught up.
+  EXPECT_THAT(fixed_step.Advance(5ms), Eq(1));
+}
+
+// NOLINTNEXTLINE
+TEST(FixedStepTest, CatchesUpWithoutDilation) {
+  FixedStep fixed_step({
+      .interval = 10ms,
+      .max_frame_duration = 100ms,
+      .max_substeps = 3,
+      .dilate_time = false,
+  });
+
+  EXPECT_THAT(fixed_step.Advance(55ms), Eq(3));
+  EXPECT_THAT(fixed_step.Alpha(), FloatEq(1.0F));
+  EXPECT_THAT(fixed_step.Advance(0ms), Eq(2));
+  EXPECT_THAT(fixed_step.Alpha(), FloatEq(0.5F));
+  EXPECT_THAT(fixed_step.GetStats().dilated_time, Eq(Duration::zero()));
+}
@@ -0,0 +1,117 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "oxygen/core/frame_arena.h"
+
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using oxygen::core::FrameArena;
+
+using testing::Eq;
+using testing::Ge;
+using testing::IsTrue;
+
+namespace {
+
+// Counts the allocations that reach the upstream resource.
+class CountingResource final : public std::pmr::memory_resource {
+public:
+  [[nodiscard]] auto Allocations() const -> int {
+    return allocations_;
+  }
+
+private:
+  auto do_allocate(size_t bytes, size_t alignment) -> void * override {
+    ++allocations_;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void *ptr, size_t bytes, size_t alignment) override {
+    std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+  }
+  [[nodiscard]] auto do_is_equal(
+      const memory_resource &other) const noexcept -> bool override {
+    return this == &other;
+  }
+
+  int allocations_{0};
+};
+
+} // namespace
+
+// NOLINTNEXTLINE
+TEST(FrameArenaTest, AllocationsAreAligned) {
+  FrameArena arena(1024);
+  auto &resource = arena.Resource();
+
+  (void)resource.allocate(1, 1);
+  auto *ptr = resource.allocate(16, 16);
+  EXPECT_THAT(reinterpret_cast<std::uintptr_t>(ptr) % 16, Eq(0));
+  ptr = resource.allocate(8, 64);
+  EXPECT_THAT(reinterpret_cast<std::uintptr_t>(ptr) % 64, Eq(0));
+  EXPECT_THAT(arena.BytesUsed(), Ge(1 + 16 + 8));
+}
+
+// NOLINTNEXTLINE
+TEST(FrameArenaTest, PreviousFrameDataStaysValid) {
+  FrameArena arena(1024);
+
+  std::pmr::vector<int> previous({1, 2, 3}, &arena.Resource());
+  arena.NextFrame();
+  // Allocations in the new frame must not overwrite the previous frame.
+  std::pmr::vector<int> current({4, 5, 6}, &arena.Resource());
+  EXPECT_THAT(previous, testing::ElementsAre(1, 2, 3));
+  EXPECT_THAT(current, testing::ElementsAre(4, 5, 6));
+}
+
+// NOLINTNEXTLINE
+TEST(FrameArenaTest, MemoryIsReclaimedEveryOtherFrame) {
+  FrameArena arena(1024);
+
+  (void)arena.Resource().allocate(512, 8);
+  const auto *first = arena.Resource().allocate(8, 8);
+  arena.NextFrame();
+  EXPECT_THAT(arena.BytesUsed(), Eq(0));
+  (void)arena.Resource().allocate(8, 8);
+  arena.NextFrame();
+  EXPECT_THAT(arena.BytesUsed(), Eq(0));
+  (void)arena.Resource().allocate(512, 8);
+  EXPECT_THAT(arena.Resource().allocate(8, 8) == first, IsTrue());
+}
+
+// NOLINTNEXTLINE
+TEST(FrameArenaTest, GrowsToFitTheFrameAfterOverflow) {
+  CountingResource upstream;
+  FrameArena arena(256, &upstream);
+  EXPECT_THAT(upstream.Allocations(), Eq(2));
+
+  const auto allocate_frame = [&arena]() {
+    for (int index = 0; index < 10; ++index) {
+      (void)arena.Resource().allocate(100, 8);
+    }
+  };
+
+  // Both buffers overflow once, then grow.
+  for (int frame = 0; frame < 2; ++frame) {
+    allocate_frame();
+    arena.NextFrame();
+  }
+  allocate_frame();
+  arena.NextFrame();
+  EXPECT_THAT(arena.Capacity(), Ge(1000));
+
+  // Steady state, no more upstream allocations.
+  const auto allocations = upstream.Allocations();
+  for (int frame = 0; frame < 10; ++frame) {
+    allocate_frame();
+    arena.NextFrame();
+  }
+  EXPECT_THAT(upstream.Allocations(), Eq(allocations));
+}
@@ -0,0 +1,78 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "oxygen/core/frame_pacer.h"
+
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "oxygen/base/time.h"
+
+using oxygen::Duration;
+using oxygen::Time;
+using oxygen::core::FramePacer;
+
+using testing::Eq;
+using testing::Ge;
+using testing::Gt;
+using testing::Le;
+
+using namespace std::chrono_literals;
+
+// NOLINTNEXTLINE
+TEST(FramePacerTest, UnlimitedDoesNotWait) {
+  FramePacer pacer;
+  EXPECT_THAT(pacer.TargetFrameTime(), Eq(Duration::zero()));
+
+  const auto start = Time::Now();
+  for (int frame = 0; frame < 100; ++frame) {
+    pacer.EndFrame();
+  }
+  EXPECT_THAT(Time::Now() - start, Le(Duration(50ms)));
+}
+
+// NOLINTNEXTLINE
+TEST(FramePacerTest, LimitsFrameRate) {
+  FramePacer pacer(200.0F);
+  EXPECT_THAT(pacer.TargetFrameTime(), Eq(Duration(5ms)));
+
+  const auto start = Time::Now();
+  for (int frame = 0; frame < 20; ++frame) {
+    pacer.EndFrame();
+  }
+  EXPECT_THAT(Time::Now() - start, Ge(Duration(100ms)));
+
+  const auto stats = pacer.GetStats();
+  EXPECT_THAT(stats.average_frame_time, Ge(Duration(4'900us)));
+  EXPECT_THAT(stats.max_frame_time, Ge(stats.average_frame_time));
+}
+
+// NOLINTNEXTLINE
+TEST(FramePacerTest, LateFramesDoNotAccumulate) {
+  FramePacer pacer(200.0F);
+
+  std::this_thread::sleep_for(30ms);
+  pacer.EndFrame();
+  // The next frame is due one frame time after the late one, not right away
+  // to catch up with the missed deadlines.
+  const auto start = Time::Now();
+  pacer.EndFrame();
+  EXPECT_THAT(Time::Now() - start, Gt(Duration(4ms)));
+}
+
+// NOLINTNEXTLINE
+TEST(FramePacerTest, MeasuresJitter) {
+  FramePacer pacer;
+  for (int frame = 0; frame < 10; ++frame) {
+    std::this_thread::sleep_for(frame % 2 == 0 ? 1ms : 9ms);
+    pacer.EndFrame();
+  }
+  const auto stats = pacer.GetStats();
+  EXPECT_THAT(stats.max_frame_time, Ge(Duration(9ms)));
+  EXPECT_THAT(stats.jitter, Ge(Duration(3ms)));
+}
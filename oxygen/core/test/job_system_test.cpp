@@ -0,0 +1,146 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "oxygen/core/job_system.h"
+
+#include <atomic>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using oxygen::core::JobCounter;
+using oxygen::core::JobSystem;
+
+using testing::Each;
+using testing::Eq;
+using testing::IsFalse;
+using testing::IsTrue;
+
+// NOLINTNEXTLINE
+TEST(JobSystemTest, ScheduleAndWaitForHandle) {
+  JobSystem job_system({.worker_count = 2});
+  EXPECT_THAT(job_system.WorkerCount(), Eq(2));
+
+  bool executed{false};
+  const auto handle = job_system.Schedule([&executed]() { executed = true; });
+  EXPECT_THAT(handle.IsValid(), IsTrue());
+  job_system.Wait(handle);
+  EXPECT_THAT(handle.IsDone(), IsTrue());
+  EXPECT_THAT(executed, IsTrue());
+}
+
+// NOLINTNEXTLINE
+TEST(JobSystemTest, WaitForCounter) {
+  JobSystem job_system({.worker_count = 3});
+
+  constexpr int kJobs = 1000;
+  std::atomic<int> executed{0};
+  JobCounter counter;
+  for (int index = 0; index < kJobs; ++index) {
+    job_system.Schedule([&executed]() { ++executed; }, counter);
+  }
+  job_system.Wait(counter);
+  EXPECT_THAT(counter.IsDone(), IsTrue());
+  EXPECT_THAT(executed.load(), Eq(kJobs));
+}
+
+// NOLINTNEXTLINE
+TEST(JobSystemTest, NestedJobsCanWait) {
+  JobSystem job_system({.worker_count = 1});
+
+  std::atomic<int> executed{0};
+  const auto handle = job_system.Schedule([&job_system, &executed]() {
+    JobCounter counter;
+    for (int index = 0; index < 10; ++index) {
+      job_system.Schedule([&executed]() { ++executed; }, counter);
+    }
+    // With a single worker, this only completes if waiting runs the jobs.
+    job_system.Wait(counter);
+  });
+  job_system.Wait(handle);
+  EXPECT_THAT(executed.load(), Eq(10));
+}
+
+// NOLINTNEXTLINE
+TEST(JobSystemTest, WorkerHintSelectsQueue) {
+  JobSystem job_system({.worker_count = 2});
+
+  size_t worker{JobSystem::kAnyWorker};
+  const auto handle = job_system.Schedule(
+      [&job_system, &worker]() { worker = job_system.CurrentWorker(); }, 1);
+  // Do not use Wait(), which would run the job on this thread.
+  while (!handle.IsDone()) {
+    std::this_thread::yield();
+  }
+  // The job may be stolen, but it always runs on a worker thread.
+  EXPECT_THAT(worker < job_system.WorkerCount(), IsTrue());
+  EXPECT_THAT(job_system.CurrentWorker(), Eq(JobSystem::kAnyWorker));
+}
+
+// NOLINTNEXTLINE
+TEST(JobSystemTest, ParallelForVisitsEachIndexOnce) {
+  JobSystem job_system({.worker_count = 4});
+
+  std::vector<int> visits(10'000, 0);
+  job_system.ParallelFor(
+      0, visits.size(), [&visits](const size_t index) { ++visits[index]; });
+  EXPECT_THAT(visits, Each(Eq(1)));
+
+  std::vector<int> values(1'000);
+  std::iota(values.begin(), values.end(), 0);
+  job_system.ParallelFor(
+      std::span(values), [](int &value) { value *= 2; }, 7);
+  for (size_t index = 0; index < values.size(); ++index) {
+    EXPECT_THAT(values[index], Eq(static_cast<int>(index) * 2));
+  }
+}
+
+// NOLINTNEXTLINE
+TEST(JobSystemTest, DestructorCompletesQueuedJobs) {
+  std::atomic<int> executed{0};
+  {
+    JobSystem job_system({.worker_count = 2});
+    for (int index = 0; index < 100; ++index) {
+      job_system.Schedule([&executed]() { ++executed; });
+    }
+  }
+  EXPECT_THAT(executed.load(), Eq(100));
+}
+
+// NOLINTNEXTLINE
+TEST(JobSystemTest, BackgroundJobsOnlyRunOnWorkers) {
+  JobSystem job_system({.worker_count = 1});
+
+  // Keep the only worker busy, so that the waiting thread has to help.
+  std::atomic<bool> worker_busy{false};
+  std::atomic<bool> release_worker{false};
+  const auto busy = job_system.Schedule([&worker_busy, &release_worker]() {
+    worker_busy.store(true);
+    while (!release_worker.load()) {
+      std::this_thread::yield();
+    }
+  });
+  while (!worker_busy.load()) {
+    std::this_thread::yield();
+  }
+
+  std::atomic<size_t> background_worker{JobSystem::kAnyWorker};
+  const auto background = job_system.ScheduleBackground(
+      [&job_system, &background_worker]() {
+        background_worker.store(job_system.CurrentWorker());
+      });
+  const auto foreground = job_system.Schedule([]() {});
+  job_system.Wait(foreground);
+  EXPECT_THAT(background.IsDone(), IsFalse());
+
+  release_worker.store(true);
+  job_system.Wait(background);
+  EXPECT_THAT(background_worker.load(), Eq(0));
+  EXPECT_THAT(busy.IsDone(), IsTrue());
+}
@@ -0,0 +1,66 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "oxygen/core/module_stats.h"
+
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using oxygen::Duration;
+using oxygen::core::ModulePhase;
+using oxygen::core::ModuleStats;
+
+using testing::Eq;
+
+using namespace std::chrono_literals;
+
+// NOLINTNEXTLINE
+TEST(ModuleStatsTest, EmptyBeforeTheFirstFrame) {
+  const ModuleStats stats;
+  const auto timings = stats.Timings();
+  EXPECT_THAT(timings[ModulePhase::kUpdate].max, Eq(Duration::zero()));
+}
+
+// NOLINTNEXTLINE
+TEST(ModuleStatsTest, AccumulatesPhasesOverTheFrame) {
+  ModuleStats stats;
+  stats.Record(ModulePhase::kFixedUpdate, 2ms);
+  stats.Record(ModulePhase::kFixedUpdate, 3ms);
+  stats.Record(ModulePhase::kRender, 4ms);
+  stats.EndFrame();
+
+  const auto timings = stats.Timings();
+  EXPECT_THAT(timings[ModulePhase::kFixedUpdate].last, Eq(Duration(5ms)));
+  EXPECT_THAT(timings[ModulePhase::kRender].last, Eq(Duration(4ms)));
+  EXPECT_THAT(timings[ModulePhase::kUpdate].last, Eq(Duration::zero()));
+}
+
+// NOLINTNEXTLINE
+TEST(ModuleStatsTest, AveragesOverTheWindow) {
+  ModuleStats stats;
+  for (size_t frame = 0; frame < 2 * ModuleStats::kWindow; ++frame) {
+    // The first window is much slower, and must be forgotten.
+    const auto duration = frame < ModuleStats::kWindow ? Duration(100ms)
+                          : frame % 2 == 0             ? Duration(1ms)
+                                                       : Duration(3ms);
+    stats.Record(ModulePhase::kUpdate, duration);
+    stats.EndFrame();
+  }
+
+  const auto timings = stats.Timings();
+  EXPECT_THAT(timings[ModulePhase::kUpdate].average, Eq(Duration(2ms)));
+  EXPECT_THAT(timings[ModulePhase::kUpdate].max, Eq(Duration(3ms)));
+  EXPECT_THAT(timings[ModulePhase::kUpdate].last, Eq(Duration(3ms)));
+}
+
+// NOLINTNEXTLINE
+TEST(ModuleStatsTest, PhaseNames) {
+  EXPECT_THAT(std::string(to_string(ModulePhase::kProcessInput)),
+      Eq("ProcessInput"));
+  EXPECT_THAT(std::string(to_string(ModulePhase::kRender)), Eq("Render"));
+}
@@ -0,0 +1,206 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "oxygen/core/system_scheduler.h"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "oxygen/core/job_system.h"
+
+using oxygen::core::JobSystem;
+using oxygen::engine::System;
+using oxygen::engine::SystemScheduler;
+using oxygen::engine::SystemUpdateContext;
+
+using testing::ElementsAre;
+using testing::Eq;
+using testing::IsFalse;
+using testing::IsTrue;
+
+namespace {
+
+class CallbackSystem final : public System {
+public:
+  explicit CallbackSystem(std::function<void()> callback)
+      : callback_(std::move(callback)) {
+  }
+
+  void Update(const SystemUpdateContext & /*update_context*/) override {
+    callback_();
+  }
+
+private:
+  std::function<void()> callback_;
+};
+
+// Records the order in which the systems have been updated.
+class UpdateLog {
+public:
+  auto MakeSystem(std::string name) -> std::shared_ptr<System> {
+    return std::make_shared<CallbackSystem>([this, name]() {
+      std::lock_guard lock(mutex_);
+      names_.push_back(name);
+    });
+  }
+
+  [[nodiscard]] auto Names() const -> const std::vector<std::string> & {
+    return names_;
+  }
+
+private:
+  std::mutex mutex_;
+  std::vector<std::string> names_;
+};
+
+} // namespace
+
+// NOLINTNEXTLINE
+TEST(SystemSchedulerTest, RejectsDuplicateNames) {
+  JobSystem job_system({.worker_count = 1});
+  SystemScheduler scheduler(job_system);
+  UpdateLog log;
+  const auto system = log.MakeSystem("a");
+
+  EXPECT_THAT(scheduler.Register(system, {.name = "a"}), IsTrue());
+  EXPECT_THAT(scheduler.Register(system, {.name = "a"}), IsFalse());
+  EXPECT_THAT(scheduler.Size(), Eq(1));
+  EXPECT_THAT(scheduler.Unregister("a"), IsTrue());
+  EXPECT_THAT(scheduler.Unregister("a"), IsFalse());
+  EXPECT_THAT(scheduler.Size(), Eq(0));
+}
+
+// NOLINTNEXTLINE
+TEST(SystemSchedulerTest, RunAfterOrdersSystems) {
+  JobSystem job_system({.worker_count = 3});
+  SystemScheduler scheduler(job_system);
+  UpdateLog log;
+  const auto first = log.MakeSystem("first");
+  const auto second = log.MakeSystem("second");
+  const auto third = log.MakeSystem("third");
+
+  // Registered in reverse order, and with no conflicting accesses.
+  scheduler.Register(third, {.name = "third", .run_after = {"second"}});
+  scheduler.Register(second, {.name = "second", .run_after = {"first"}});
+  scheduler.Register(first, {.name = "first"});
+
+  scheduler.Update({});
+  EXPECT_THAT(log.Names(), ElementsAre("first", "second", "third"));
+}
+
+// NOLINTNEXTLINE
+TEST(SystemSchedulerTest, ConflictingSystemsRunInRegistrationOrder) {
+  JobSystem job_system({.worker_count = 3});
+  SystemScheduler scheduler(job_system);
+  UpdateLog log;
+  const auto writer = log.MakeSystem("writer");
+  const auto reader = log.MakeSystem("reader");
+  const auto other_writer = log.MakeSystem("other_writer");
+
+  scheduler.Register(writer, {.name = "writer", .writes = {"positions"}});
+  scheduler.Register(reader, {.name = "reader", .reads = {"positions"}});
+  scheduler.Register(
+      other_writer, {.name = "other_writer", .writes = {"positions"}});
+
+  for (int frame = 0; frame < 10; ++frame) {
+    scheduler.Update({});
+  }
+  ASSERT_THAT(log.Names().size(), Eq(30));
+  for (size_t index = 0; index < log.Names().size(); index += 3) {
+    EXPECT_THAT(log.Names()[index], Eq("writer"));
+    EXPECT_THAT(log.Names()[index + 1], Eq("reader"));
+    EXPECT_THAT(log.Names()[index + 2], Eq("other_writer"));
+  }
+}
+
+// NOLINTNEXTLINE
+TEST(SystemSchedulerTest, ConflictingSystemsFollowIndirectConstraints) {
+  JobSystem job_system({.worker_count = 3});
+  SystemScheduler scheduler(job_system);
+  UpdateLog log;
+  const auto first = log.MakeSystem("first");
+  const auto middle = log.MakeSystem("middle");
+  const auto last = log.MakeSystem("last");
+
+  // `last` and `first` conflict, and `last` is explicitly ordered after
+  // `first` through `middle`, against their registration order.
+  scheduler.Register(last, {.name = "last",
+                               .writes = {"positions"},
+                               .run_after = {"middle"}});
+  scheduler.Register(middle, {.name = "middle", .run_after = {"first"}});
+  scheduler.Register(first, {.name = "first", .writes = {"positions"}});
+
+  scheduler.Update({});
+  EXPECT_THAT(log.Names(), ElementsAre("first", "middle", "last"));
+}
+
+// NOLINTNEXTLINE
+TEST(SystemSchedulerTest, IndependentSystemsRunInParallel) {
+  JobSystem job_system({.worker_count = 2});
+  SystemScheduler scheduler(job_system);
+
+  // Each system waits for the other one to start, which only completes if
+  // they run at the same time.
+  std::atomic<int> started{0};
+  const auto rendezvous = [&started]() {
+    ++started;
+    while (started.load() < 2) {
+      std::this_thread::yield();
+    }
+  };
+  const auto reader = std::make_shared<CallbackSystem>(rendezvous);
+  const auto other_reader = std::make_shared<CallbackSystem>(rendezvous);
+  scheduler.Register(reader, {.name = "reader", .reads = {"positions"}});
+  scheduler.Register(
+      other_reader, {.name = "other_reader", .reads = {"positions"}});
+
+  scheduler.Update({});
+  EXPECT_THAT(started.load(), Eq(2));
+}
+
+// NOLINTNEXTLINE
+TEST(SystemSchedulerTest, CycleFallsBackToRegistrationOrder) {
+  JobSystem job_system({.worker_count = 2});
+  SystemScheduler scheduler(job_system);
+  UpdateLog log;
+  const auto first = log.MakeSystem("first");
+  const auto second = log.MakeSystem("second");
+
+  scheduler.Register(first, {.name = "first", .run_after = {"second"}});
+  scheduler.Register(second, {.name = "second", .run_after = {"first"}});
+
+  scheduler.Update({});
+  EXPECT_THAT(log.Names(), ElementsAre("first", "second"));
+}
+
+// NOLINTNEXTLINE
+TEST(SystemSchedulerTest, ReportsTimingsAndSkipsDestroyedSystems) {
+  JobSystem job_system({.worker_count = 1});
+  SystemScheduler scheduler(job_system);
+  UpdateLog log;
+  const auto kept = log.MakeSystem("kept");
+  auto destroyed = log.MakeSystem("destroyed");
+
+  scheduler.Register(kept, {.name = "kept"});
+  scheduler.Register(destroyed, {.name = "destroyed"});
+  destroyed.reset();
+
+  scheduler.Update({});
+  EXPECT_THAT(log.Names(), ElementsAre("kept"));
+  ASSERT_THAT(scheduler.Timings().size(), Eq(2));
+  EXPECT_THAT(scheduler.Timings()[0].name, Eq("kept"));
+  EXPECT_THAT(scheduler.Timings()[1].name, Eq("destroyed"));
+  EXPECT_THAT(scheduler.Timings()[0].max >= scheduler.Timings()[0].last,
+      IsTrue());
+}
@@ -0,0 +1,158 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "oxygen/core/time_slicer.h"
+
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "oxygen/base/time.h"
+
+using oxygen::Time;
+using oxygen::core::TimeSlice;
+using oxygen::core::TimeSlicer;
+
+using testing::Each;
+using testing::ElementsAre;
+using testing::Eq;
+
+using namespace std::chrono_literals;
+
+namespace {
+auto Later() {
+  return Time::Now() + oxygen::Duration(1s);
+}
+} // namespace
+
+// NOLINTNEXTLINE
+TEST(TimeSlicerTest, RunsTasksByDecreasingPriority) {
+  TimeSlicer slicer;
+  std::vector<std::string> runs;
+  const auto task = [&runs](std::string name) {
+    return [&runs, name = std::move(name)](const TimeSlice & /*slice*/) {
+      runs.push_back(name);
+      return false;
+    };
+  };
+  slicer.Add(task("low"), {.name = "low", .priority = 1});
+  slicer.Add(task("high"), {.name = "high", .priority = 5});
+  slicer.Add(task("medium"), {.name = "medium", .priority = 3});
+
+  slicer.Run(Later());
+  EXPECT_THAT(runs, ElementsAre("high", "medium", "low"));
+}
+
+// NOLINTNEXTLINE
+TEST(TimeSlicerTest, StartsTasksEveryDivisorFrames) {
+  TimeSlicer slicer;
+  int runs{0};
+  slicer.Add(
+      [&runs](const TimeSlice & /*slice*/) {
+        ++runs;
+        return false;
+      },
+      {.name = "periodic", .divisor = 3});
+
+  for (int frame = 0; frame < 9; ++frame) {
+    slicer.Run(Later());
+  }
+  EXPECT_THAT(runs, Eq(3));
+}
+
+// NOLINTNEXTLINE
+TEST(TimeSlicerTest, ResumesUnfinishedWork) {
+  TimeSlicer slicer;
+  int remaining{3};
+  slicer.Add(
+      [&remaining](const TimeSlice & /*slice*/) { return --remaining > 0; },
+      {.name = "resumable", .divisor = 100});
+
+  for (int frame = 0; frame < 5; ++frame) {
+    slicer.Run(Later());
+  }
+  EXPECT_THAT(remaining, Eq(0));
+}
+
+// NOLINTNEXTLINE
+TEST(TimeSlicerTest, AgesTasksWithoutSlack) {
+  TimeSlicer slicer;
+  std::vector<std::string> runs;
+  const auto low = slicer.Add(
+      [&runs](const TimeSlice & /*slice*/) {
+        runs.emplace_back("low");
+        return false;
+      },
+      {.name = "low", .priority = 0});
+  // Always uses the whole frame.
+  slicer.Add(
+      [&runs](const TimeSlice &slice) {
+        runs.emplace_back("high");
+        while (!slice.Expired()) {
+        }
+        return false;
+      },
+      {.name = "high", .priority = 1});
+
+  slicer.Run(Time::Now() + oxygen::Duration(2ms));
+  EXPECT_THAT(runs, ElementsAre("high"));
+  EXPECT_THAT(slicer.WaitingFrames(low), Eq(1U));
+
+  // After waiting one frame, the low priority task catches up.
+  slicer.Run(Time::Now() + oxygen::Duration(2ms));
+  EXPECT_THAT(runs, ElementsAre("high", "low", "high"));
+  EXPECT_THAT(slicer.WaitingFrames(low), Eq(0U));
+}
+
+// NOLINTNEXTLINE
+TEST(TimeSlicerTest, SliceIsBoundedByTheBudget) {
+  TimeSlicer slicer;
+  const auto deadline = Later();
+  oxygen::TimePoint slice_deadline{};
+  slicer.Add(
+      [&slice_deadline](const TimeSlice &slice) {
+        slice_deadline = slice.Deadline();
+        return false;
+      },
+      {.name = "budgeted", .budget = oxygen::Duration(1ms)});
+
+  slicer.Run(deadline);
+  EXPECT_THAT(slice_deadline < deadline, Eq(true));
+  EXPECT_THAT(slicer.Remove(0), Eq(true));
+  EXPECT_THAT(slicer.Size(), Eq(0U));
+}
+
+// NOLINTNEXTLINE
+TEST(TimeSlicerTest, TasksAddedByARunningTaskStartNextFrame) {
+  TimeSlicer slicer;
+  std::vector<std::string> runs;
+  slicer.Add(
+      [&slicer, &runs](const TimeSlice & /*slice*/) {
+        runs.emplace_back("spawner");
+        // Enough tasks to grow the task list while this one runs.
+        for (int index = 0; index < 64; ++index) {
+          slicer.Add(
+              [&runs](const TimeSlice & /*slice*/) {
+                runs.emplace_back("spawned");
+                return false;
+              },
+              {.name = "spawned"});
+        }
+        return false;
+      },
+      {.name = "spawner", .divisor = 100});
+
+  slicer.Run(Later());
+  EXPECT_THAT(runs, ElementsAre("spawner"));
+  EXPECT_THAT(slicer.Size(), Eq(65));
+
+  runs.clear();
+  slicer.Run(Later());
+  EXPECT_THAT(runs, Each(Eq("spawned")));
+  EXPECT_THAT(runs.size(), Eq(64));
+}
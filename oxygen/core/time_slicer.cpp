@@ -0,0 +1,78 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "oxygen/core/time_slicer.h"
+
+#include <algorithm>
+#include <iterator>
+
+using oxygen::core::TimeSlicer;
+
+auto TimeSlicer::Add(Work work, TaskOptions options) -> TaskId {
+  options.divisor = std::max(options.divisor, 1U);
+  const auto id = next_id_++;
+  auto &tasks = running_ ? added_ : tasks_;
+  tasks.push_back(Task{
+      .id = id,
+      .work = std::move(work),
+      .options = std::move(options),
+  });
+  return id;
+}
+
+auto TimeSlicer::Remove(const TaskId task) -> bool {
+  return std::erase_if(tasks_, [task](const auto &entry) {
+    return entry.id == task;
+  }) != 0;
+}
+
+void TimeSlicer::Run(const TimePoint deadline) {
+  order_.clear();
+  for (size_t index = 0; index < tasks_.size(); ++index) {
+    auto &task = tasks_[index];
+    // Use the task id to stagger the tasks with the same divisor.
+    if ((frame_ + task.id) % task.options.divisor == 0) {
+      task.pending = true;
+    }
+    if (task.pending) {
+      order_.push_back(index);
+    }
+  }
+  ++frame_;
+
+  const auto effective_priority = [this](const size_t index) {
+    const auto &task = tasks_[index];
+    return static_cast<int64_t>(task.options.priority) + task.waiting_frames;
+  };
+  std::ranges::stable_sort(order_, [&](const size_t lhs, const size_t rhs) {
+    return effective_priority(lhs) > effective_priority(rhs);
+  });
+
+  running_ = true;
+  for (const auto index : order_) {
+    auto &task = tasks_[index];
+    const auto now = Time::Now();
+    if (now >= deadline) {
+      ++task.waiting_frames;
+      continue;
+    }
+    auto slice_deadline = deadline;
+    if (task.options.budget != Duration::zero()) {
+      slice_deadline = std::min(deadline, now + task.options.budget);
+    }
+    task.waiting_frames = 0;
+    task.pending = task.work(TimeSlice(slice_deadline));
+  }
+  running_ = false;
+  std::ranges::move(added_, std::back_inserter(tasks_));
+  added_.clear();
+}
+
+auto TimeSlicer::WaitingFrames(const TaskId task) const -> uint32_t {
+  const auto found = std::ranges::find_if(
+      tasks_, [task](const auto &entry) { return entry.id == task; });
+  return found == tasks_.end() ? 0 : found->waiting_frames;
+}
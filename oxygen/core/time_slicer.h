@@ -0,0 +1,111 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "oxygen/base/time.h"
+#include "oxygen/base/types.h"
+
+namespace oxygen::core {
+
+//! The time a unit of work is given to run in the current frame.
+class TimeSlice {
+public:
+  explicit TimeSlice(const TimePoint deadline) : deadline_(deadline) {
+  }
+
+  [[nodiscard]] auto Deadline() const noexcept -> TimePoint {
+    return deadline_;
+  }
+
+  [[nodiscard]] auto Expired() const -> bool {
+    return Time::Now() >= deadline_;
+  }
+
+private:
+  TimePoint deadline_;
+};
+
+/*!
+ Spreads low priority, amortizable work over the frames, in the slack left at
+ the end of each frame.
+
+ A task is a resumable unit of work, called with the slice of time it is given
+ in the frame. It does a bounded amount of work, checks whether the slice has
+ expired, and returns `true` when it has more to do, to be resumed in the next
+ frames, or `false` once done, to be started again at its next period.
+
+ Tasks run in decreasing priority order, until the time of the frame runs out.
+ The tasks that did not get a slice are aged: their priority increases by one
+ for each frame they wait, so that low priority tasks are not starved by a
+ continuously busy frame.
+*/
+class TimeSlicer {
+public:
+  using TaskId = uint32_t;
+  using Work = std::function<bool(const TimeSlice &slice)>;
+
+  struct TaskOptions {
+    std::string name;
+    int32_t priority{0};
+    // Maximum time given to the task in one frame, `0` for whatever remains
+    // of the frame.
+    Duration budget{0};
+    // The task is started every `divisor` frames. The frames of the tasks with
+    // the same divisor are staggered, so that they do not all start together.
+    uint32_t divisor{1};
+  };
+
+  TimeSlicer() = default;
+
+  //! May be called by a running task, the new task then only takes part in
+  //! the next `Run()`.
+  auto Add(Work work, TaskOptions options) -> TaskId;
+  //! Must not be called by a running task.
+  auto Remove(TaskId task) -> bool;
+
+  [[nodiscard]] auto Size() const noexcept -> size_t {
+    return tasks_.size() + added_.size();
+  }
+
+  //! Give slices of the time remaining until `deadline` to the tasks due in
+  //! this frame.
+  void Run(TimePoint deadline);
+
+  //! Number of frames since the task last got a slice while it was due, `0`
+  //! when it is not waiting.
+  [[nodiscard]] auto WaitingFrames(TaskId task) const -> uint32_t;
+
+private:
+  struct Task {
+    TaskId id;
+    Work work;
+    TaskOptions options;
+    // Whether the task has work to do, started or not, independently of its
+    // period.
+    bool pending{false};
+    uint32_t waiting_frames{0};
+  };
+
+  std::vector<Task> tasks_;
+  // Tasks added by the running tasks, which must not move `tasks_` while one
+  // of its elements runs. Appended to it at the end of `Run()`.
+  std::vector<Task> added_;
+  bool running_{false};
+  // Due tasks of the current frame, in execution order, kept as a member to
+  // reuse its storage.
+  std::vector<size_t> order_;
+  TaskId next_id_{0};
+  uint64_t frame_{0};
+};
+
+} // namespace oxygen::core
@@ -100,6 +100,16 @@ auto ActionTriggerTimed::DoUpdateState(
   return false;
 }
 
+auto ActionTriggerTimed::TimeUntilHeldFor(const Duration threshold) const
+    -> Duration {
+  // The held duration restarts from zero at the update after a trigger.
+  if (IsTriggered()) {
+    return threshold;
+  }
+  return held_duration_ < threshold ? threshold - held_duration_
+                                    : Duration::zero();
+}
+
 //-- ActionTriggerHold ---------------------------------------------------------
 
 auto ActionTriggerHold::DoUpdateState(
@@ -117,6 +127,14 @@ auto ActionTriggerHold::DoUpdateState(
   return false;
 }
 
+auto ActionTriggerHold::GetWakeUpDelay() const -> Duration {
+  // A one shot hold that fired waits for the input to be released.
+  if (triggered_once_ && IsOneShot()) {
+    return Duration::max();
+  }
+  return TimeUntilHeldFor(hold_duration_threshold_);
+}
+
 //-- ActionTriggerHoldAndRelease -----------------------------------------------
 
 auto ActionTriggerHoldAndRelease::DoUpdateState(
@@ -130,6 +148,15 @@ auto ActionTriggerHoldAndRelease::DoUpdateState(
   return false;
 }
 
+auto ActionTriggerHoldAndRelease::GetWakeUpDelay() const -> Duration {
+  // Only the release triggers, but the held duration does not grow at the
+  // update of the release, it must reach the threshold before.
+  const auto held_duration = GetHeldDuration();
+  return held_duration < hold_duration_threshold_
+             ? hold_duration_threshold_ - held_duration
+             : Duration::max();
+}
+
 //-- ActionTriggerPulse --------------------------------------------------------
 
 auto ActionTriggerPulse::DoUpdateState(
@@ -150,6 +177,17 @@ auto ActionTriggerPulse::DoUpdateState(
   return false;
 }
 
+auto ActionTriggerPulse::GetWakeUpDelay() const -> Duration {
+  // Triggering on start means triggering at every update.
+  if (trigger_on_start_) {
+    return Duration::zero();
+  }
+  if ((trigger_limit_ != 0) && (trigger_count_ >= trigger_limit_)) {
+    return Duration::max();
+  }
+  return TimeUntilHeldFor(interval_);
+}
+
 //-- ActionTriggerTap ----------------------------------------------------------
 
 auto ActionTriggerTap::DoUpdateState(
@@ -163,6 +201,15 @@ auto ActionTriggerTap::DoUpdateState(
   return false;
 }
 
+auto ActionTriggerTap::GetWakeUpDelay() const -> Duration {
+  // Only the release triggers, but the held duration does not grow at the
+  // update of the release, it must be seen going past the threshold.
+  const auto held_duration = GetHeldDuration();
+  return held_duration <= threshold_
+             ? threshold_ - held_duration + Duration{1}
+             : Duration::max();
+}
+
 //-- ActionTriggerChain --------------------------------------------------------
 
 void ActionTriggerChain::SetLinkedAction(std::shared_ptr<Action> action) {
@@ -100,6 +100,14 @@ public:
 
   void UpdateState(const ActionValue &action_value, Duration delta_time);
 
+  //! How long, after its last update and with an unchanged input value, the
+  //! trigger can go without updates before its state may change.
+  //! `Duration::zero()` when it must be updated every frame, which is the
+  //! default, and `Duration::max()` when only a change of input can change it.
+  [[nodiscard]] virtual auto GetWakeUpDelay() const -> Duration {
+    return Duration::zero();
+  }
+
 protected:
   enum class State : uint8_t {
     kIdle,
@@ -167,6 +175,11 @@ public:
     return ActionTriggerType::kReleased;
   }
 
+  //! Once ongoing, only the release of the input triggers.
+  [[nodiscard]] auto GetWakeUpDelay() const -> Duration override {
+    return Duration::max();
+  }
+
 protected:
   auto DoUpdateState(const ActionValue &action_value,
       Duration delta_time [[maybe_unused]]) -> bool override;
@@ -226,6 +239,10 @@ protected:
     return held_duration_;
   }
 
+  //! Time until the held duration reaches `threshold`, counting from the reset
+  //! at the next update when the trigger just fired.
+  [[nodiscard]] auto TimeUntilHeldFor(Duration threshold) const -> Duration;
+
 private:
   Duration held_duration_{0};
 };
@@ -265,6 +282,8 @@ public:
     return triggered_once_ && (IsIdle());
   }
 
+  [[nodiscard]] auto GetWakeUpDelay() const -> Duration override;
+
 protected:
   auto DoUpdateState(
       const ActionValue &action_value, Duration delta_time) -> bool override;
@@ -299,6 +318,8 @@ public:
     return hold_duration_threshold_;
   }
 
+  [[nodiscard]] auto GetWakeUpDelay() const -> Duration override;
+
 protected:
   auto DoUpdateState(
       const ActionValue &action_value, Duration delta_time) -> bool override;
@@ -357,6 +378,8 @@ public:
            IsIdle() && (GetPreviousState() == State::kOngoing);
   }
 
+  [[nodiscard]] auto GetWakeUpDelay() const -> Duration override;
+
 protected:
   auto DoUpdateState(
       const ActionValue &action_value, Duration delta_time) -> bool override;
@@ -398,6 +421,8 @@ public:
     return false;
   }
 
+  [[nodiscard]] auto GetWakeUpDelay() const -> Duration override;
+
 protected:
   auto DoUpdateState(
       const ActionValue &action_value, Duration delta_time) -> bool override;
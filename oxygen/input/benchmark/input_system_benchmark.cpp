@@ -0,0 +1,354 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+// Micro-benchmark of the input system dispatch and trigger evaluation.
+//
+// Synthetic mapping configurations, using every trigger type, are driven by
+// synthetic event storms for a number of 60 Hz frames. Each scenario reports
+// the cost of `ProcessInput` per event, the cost of `Update` per frame and the
+// number of heap allocations per frame, as the best of a number of
+// repetitions.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "oxygen/base/compilers.h"
+
+OXYGEN_DIAGNOSTIC_PUSH
+#if defined(__clang__) || defined(ASAP_GNUC_VERSION)
+#pragma GCC diagnostic ignored "-Wswitch-enum"
+#pragma GCC diagnostic ignored "-Wswitch-default"
+#endif
+#include "fmt/core.h"
+OXYGEN_DIAGNOSTIC_POP
+
+#include "oxygen/core/system.h"
+#include "oxygen/input/action.h"
+#include "oxygen/input/action_triggers.h"
+#include "oxygen/input/input_action_mapping.h"
+#include "oxygen/input/input_mapping_context.h"
+#include "oxygen/input/input_system.h"
+#include "oxygen/logging/logging.h"
+#include "oxygen/platform-null/platform.h"
+#include "oxygen/platform/input.h"
+#include "oxygen/platform/input_event.h"
+
+using oxygen::Duration;
+using oxygen::TimePoint;
+using oxygen::engine::SystemUpdateContext;
+using oxygen::input::Action;
+using oxygen::input::ActionTrigger;
+using oxygen::input::ActionTriggerChain;
+using oxygen::input::ActionTriggerCombo;
+using oxygen::input::ActionTriggerDown;
+using oxygen::input::ActionTriggerHold;
+using oxygen::input::ActionTriggerHoldAndRelease;
+using oxygen::input::ActionTriggerPressed;
+using oxygen::input::ActionTriggerPulse;
+using oxygen::input::ActionTriggerReleased;
+using oxygen::input::ActionTriggerTap;
+using oxygen::input::ActionValueType;
+using oxygen::input::InputActionMapping;
+using oxygen::input::InputMappingContext;
+using oxygen::input::InputSystem;
+using oxygen::platform::ButtonState;
+using oxygen::platform::InputEvent;
+using oxygen::platform::InputSlot;
+using oxygen::platform::InputSlots;
+using oxygen::platform::Key;
+using oxygen::platform::KeyEvent;
+using oxygen::platform::MouseButton;
+using oxygen::platform::MouseButtonEvent;
+using oxygen::platform::MouseMotionEvent;
+using oxygen::platform::MouseWheelEvent;
+
+namespace {
+
+// Heap allocations made by the process, counted by the replacement of the
+// global operator new below.
+std::atomic<size_t> allocations{0};
+
+} // namespace
+
+// GCC reports the memory released by `free()` as mismatched once the operators
+// are inlined in their callers.
+OXYGEN_DIAGNOSTIC_PUSH
+#if defined(OXYGEN_GNUC_VERSION)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+auto operator new(const std::size_t size) -> void * {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  // NOLINTNEXTLINE(*-no-malloc, *-owning-memory)
+  if (auto *memory = std::malloc(size != 0 ? size : 1)) {
+    return memory;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept {
+  std::free(memory); // NOLINT(*-no-malloc, *-owning-memory)
+}
+
+void operator delete(void *memory, std::size_t /*size*/) noexcept {
+  std::free(memory); // NOLINT(*-no-malloc, *-owning-memory)
+}
+
+OXYGEN_DIAGNOSTIC_POP
+
+namespace {
+
+constexpr int kRepetitions = 10;
+constexpr size_t kFrames = 600;
+constexpr Duration kFrameDuration{16'667};
+
+struct Configuration {
+  size_t contexts;
+  size_t mappings_per_context;
+};
+
+struct Scenario {
+  std::string name;
+  // The events of consecutive frames, repeated for the whole run.
+  std::vector<std::vector<InputEvent>> frames;
+};
+
+struct Result {
+  std::chrono::nanoseconds process_input{std::chrono::nanoseconds::max()};
+  std::chrono::nanoseconds update{std::chrono::nanoseconds::max()};
+  size_t allocations{std::numeric_limits<size_t>::max()};
+};
+
+// The slots the mappings are spread over: the mouse axes and buttons, then the
+// keys.
+auto MappedSlots() -> std::vector<const InputSlot *> {
+  std::vector<const InputSlot *> slots{
+      &InputSlots::MouseXY,
+      &InputSlots::MouseX,
+      &InputSlots::MouseY,
+      &InputSlots::MouseWheelY,
+      &InputSlots::LeftMouseButton,
+      &InputSlots::Space,
+  };
+  for (auto key = static_cast<int>(Key::kA); key <= static_cast<int>(Key::kZ);
+      ++key) {
+    slots.push_back(&InputSlots::GetInputSlotForKey(static_cast<Key>(key)));
+  }
+  return slots;
+}
+
+auto ValueTypeFor(const InputSlot &slot) {
+  if (slot.IsAxis2D()) {
+    return ActionValueType::kAxis2D;
+  }
+  if (slot.IsAxis1D()) {
+    return ActionValueType::kAxis1D;
+  }
+  return ActionValueType::kBool;
+}
+
+// Make a trigger of each type in turn. The chain and combo triggers link to the
+// actions of the mappings made before in the same context.
+auto MakeTrigger(const size_t index,
+    const std::vector<std::shared_ptr<Action>> &previous_actions)
+    -> std::shared_ptr<ActionTrigger> {
+  switch (index % 9) {
+  case 0:
+    return std::make_shared<ActionTriggerPressed>();
+  case 1:
+    return std::make_shared<ActionTriggerReleased>();
+  case 2:
+    return std::make_shared<ActionTriggerDown>();
+  case 3: {
+    auto hold = std::make_shared<ActionTriggerHold>();
+    hold->SetHoldDurationThreshold(0.1F);
+    return hold;
+  }
+  case 4: {
+    auto hold_and_release = std::make_shared<ActionTriggerHoldAndRelease>();
+    hold_and_release->SetHoldDurationThreshold(0.1F);
+    return hold_and_release;
+  }
+  case 5: {
+    auto pulse = std::make_shared<ActionTriggerPulse>();
+    pulse->SetInterval(0.05F);
+    return pulse;
+  }
+  case 6: {
+    auto tap = std::make_shared<ActionTriggerTap>();
+    tap->SetTapReleaseThreshold(0.2F);
+    return tap;
+  }
+  case 7: {
+    auto chain = std::make_shared<ActionTriggerChain>();
+    chain->SetLinkedAction(previous_actions.back());
+    return chain;
+  }
+  default: {
+    auto combo = std::make_shared<ActionTriggerCombo>();
+    combo->AddComboStep(previous_actions[previous_actions.size() - 2]);
+    combo->AddComboStep(previous_actions.back());
+    return combo;
+  }
+  }
+}
+
+void Configure(InputSystem &input_system, const Configuration &config) {
+  const auto slots = MappedSlots();
+  size_t index{0};
+  for (size_t context_index = 0; context_index < config.contexts;
+      ++context_index) {
+    auto context = std::make_shared<InputMappingContext>(
+        fmt::format("context {}", context_index));
+    std::vector<std::shared_ptr<Action>> actions;
+    for (size_t mapping_index = 0; mapping_index < config.mappings_per_context;
+        ++mapping_index, ++index) {
+      const auto &slot = *slots[index % slots.size()];
+      auto action = std::make_shared<Action>(
+          fmt::format("action {}", index), ValueTypeFor(slot));
+      auto mapping = std::make_shared<InputActionMapping>(action, slot);
+      mapping->AddTrigger(MakeTrigger(mapping_index, actions));
+      context->AddMapping(mapping);
+      input_system.AddAction(action);
+      actions.push_back(action);
+    }
+    input_system.AddMappingContext(
+        context, static_cast<int32_t>(context_index));
+    input_system.ActivateMappingContext(context);
+  }
+}
+
+auto Idle() -> Scenario {
+  return {.name = "Idle", .frames = {{}}};
+}
+
+auto MouseMotionStorm() -> Scenario {
+  // An 8 kHz mouse, polled at 60 Hz.
+  constexpr size_t kEventsPerFrame = 8'000 / 60;
+  std::vector<InputEvent> events;
+  for (size_t index = 0; index < kEventsPerFrame; ++index) {
+    events.emplace_back(nullptr, TimePoint{0},
+        MouseMotionEvent({.x = static_cast<float>(index), .y = 100.0F},
+            {.dx = 1.0F, .dy = -1.0F}));
+  }
+  return {.name = "Mouse motion, 8 kHz", .frames = {events}};
+}
+
+auto KeyboardChord() -> Scenario {
+  // All the letter keys pressed in one frame, and released in the next.
+  std::vector<InputEvent> pressed;
+  std::vector<InputEvent> released;
+  for (auto key = static_cast<int>(Key::kA); key <= static_cast<int>(Key::kZ);
+      ++key) {
+    const KeyEvent::KeyInfo key_info(static_cast<Key>(key));
+    pressed.emplace_back(
+        nullptr, TimePoint{0}, KeyEvent(key_info, ButtonState::kPressed));
+    released.emplace_back(
+        nullptr, TimePoint{0}, KeyEvent(key_info, ButtonState::kReleased));
+  }
+  return {.name = "Letter keys chord", .frames = {pressed, released}};
+}
+
+auto MixedStorm() -> Scenario {
+  // Mouse motion with a button click and some wheel scrolling in every frame.
+  auto scenario = MouseMotionStorm();
+  auto &events = scenario.frames.front();
+  constexpr oxygen::SubPixelPosition kPosition{.x = 10.0F, .y = 10.0F};
+  events.emplace_back(nullptr, TimePoint{0},
+      MouseButtonEvent(kPosition, MouseButton::kLeft, ButtonState::kPressed));
+  events.emplace_back(nullptr, TimePoint{0},
+      MouseWheelEvent(kPosition, {.dx = 0.0F, .dy = 1.0F}));
+  events.emplace_back(nullptr, TimePoint{0},
+      MouseButtonEvent(kPosition, MouseButton::kLeft, ButtonState::kReleased));
+  scenario.name = "Mixed mouse storm";
+  return scenario;
+}
+
+auto Run(const Configuration &config, const Scenario &scenario) -> Result {
+  oxygen::platform::null::Platform platform;
+  InputSystem input_system(platform);
+  Configure(input_system, config);
+
+  SystemUpdateContext update_context{};
+  update_context.delta_time = kFrameDuration;
+
+  Result best{};
+  for (int repetition = 0; repetition < kRepetitions; ++repetition) {
+    std::chrono::nanoseconds process_input{0};
+    std::chrono::nanoseconds update{0};
+    const auto allocations_before = allocations.load(std::memory_order_relaxed);
+    for (size_t frame = 0; frame < kFrames; ++frame) {
+      const auto &events = scenario.frames[frame % scenario.frames.size()];
+      const auto start = std::chrono::steady_clock::now();
+      for (const auto &event : events) {
+        input_system.ProcessInput(event);
+      }
+      const auto processed = std::chrono::steady_clock::now();
+      update_context.time_since_start += kFrameDuration;
+      input_system.Update(update_context);
+      const auto updated = std::chrono::steady_clock::now();
+      process_input += processed - start;
+      update += updated - processed;
+    }
+    best.process_input = std::min(best.process_input, process_input);
+    best.update = std::min(best.update, update);
+    best.allocations = std::min(best.allocations,
+        allocations.load(std::memory_order_relaxed) - allocations_before);
+  }
+  return best;
+}
+
+void Report(const Configuration &config, const Scenario &scenario,
+    const Result &result) {
+  size_t events{0};
+  for (size_t frame = 0; frame < kFrames; ++frame) {
+    events += scenario.frames[frame % scenario.frames.size()].size();
+  }
+  fmt::print("{:>4} x {:<6} {:<24} {:>10.1f} ns/event {:>12.1f} ns/update "
+             "{:>8.1f} allocs/frame\n",
+      config.contexts, config.mappings_per_context, scenario.name,
+      events == 0 ? 0.0
+                  : static_cast<double>(result.process_input.count()) /
+                        static_cast<double>(events),
+      static_cast<double>(result.update.count()) / kFrames,
+      static_cast<double>(result.allocations) / kFrames);
+}
+
+} // namespace
+
+auto main() -> int {
+  // Debug logs would dominate the measurements.
+  oxygen::log::Registry::Instance().SetLogLevel(spdlog::level::warn);
+
+  fmt::print("Input system, {} frames of {} us, best of {} repetitions\n\n",
+      kFrames, kFrameDuration.count(), kRepetitions);
+
+  const std::vector<Configuration> configurations{
+      {.contexts = 1, .mappings_per_context = 16},
+      {.contexts = 4, .mappings_per_context = 64},
+      {.contexts = 16, .mappings_per_context = 256},
+  };
+  const std::vector<Scenario> scenarios{
+      Idle(),
+      MouseMotionStorm(),
+      KeyboardChord(),
+      MixedStorm(),
+  };
+  for (const auto &config : configurations) {
+    for (const auto &scenario : scenarios) {
+      Report(config, scenario, Run(config, scenario));
+    }
+    fmt::print("\n");
+  }
+  return EXIT_SUCCESS;
+}
@@ -6,6 +6,7 @@
 
 #include "oxygen/input/input_action_mapping.h"
 
+#include <algorithm>
 #include <chrono>
 #include <utility>
 
@@ -100,26 +101,23 @@ void InputActionMapping::HandleInput(const platform::InputEvent &event) {
 
   switch (event.GetType()) {
   case platform::InputEventType::kKeyEvent: {
-    const auto &k_event = dynamic_cast<const platform::KeyEvent &>(event);
+    const auto &k_event = event.As<platform::KeyEvent>();
     action_value_.Update(
         k_event.GetButtonState() == platform::ButtonState::kPressed);
   } break;
   case platform::InputEventType::kMouseButtonEvent: {
-    const auto &mb_event =
-        dynamic_cast<const platform::MouseButtonEvent &>(event);
+    const auto &mb_event = event.As<platform::MouseButtonEvent>();
     action_value_.Update(
         mb_event.GetButtonState() == platform::ButtonState::kPressed);
   } break;
   case platform::InputEventType::kMouseMotionEvent: {
-    const auto &mm_event =
-        dynamic_cast<const platform::MouseMotionEvent &>(event);
+    const auto &mm_event = event.As<platform::MouseMotionEvent>();
     action_value_.Update(
         {.x = mm_event.GetMotion().dx, .y = mm_event.GetMotion().dy});
     clear_value_after_update_ = true;
   } break;
   case platform::InputEventType::kMouseWheelEvent: {
-    const auto &mw_event =
-        dynamic_cast<const platform::MouseWheelEvent &>(event);
+    const auto &mw_event = event.As<platform::MouseWheelEvent>();
     if (slot_ == InputSlots::MouseWheelXY) {
       action_value_.Update({.x = mw_event.GetScrollAmount().dx,
           .y = mw_event.GetScrollAmount().dy});
@@ -148,9 +146,27 @@ void InputActionMapping::CancelInput() {
 auto InputActionMapping::Update(oxygen::Duration delta_time) -> bool {
   const auto input_consumed = DoUpdate(delta_time);
 
+  wake_up_delay_ = Duration::zero();
   if (clear_value_after_update_) {
+    // The cleared value is only seen by the triggers at the next update.
     action_value_.Update({0.0F, 0.0F});
     clear_value_after_update_ = false;
+  } else if (evaluation_ongoing_ && trigger_ongoing_) {
+    // The earliest of the deadlines of the ongoing triggers, only they are
+    // updated when there is no input.
+    wake_up_delay_ = Duration::max();
+    bool any_implicit_ongoing{false};
+    for (const auto &trigger : triggers_) {
+      if (trigger->IsOngoing()) {
+        any_implicit_ongoing |= trigger->IsImplicit();
+        wake_up_delay_ = std::min(wake_up_delay_, trigger->GetWakeUpDelay());
+      }
+    }
+    // After the action triggered, the next update clears again the implicit
+    // triggers state with the ongoing implicit triggers, it is not skipped.
+    if (any_implicit_ongoing && all_implicits_triggered_) {
+      wake_up_delay_ = Duration::zero();
+    }
   }
 
   return input_consumed;
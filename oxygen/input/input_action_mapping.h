@@ -38,6 +38,20 @@ public:
   void CancelInput();
   [[nodiscard]] auto Update(Duration delta_time) -> bool;
 
+  //! `true` from the input event that starts the evaluation of the triggers,
+  //! until the update that completes it. Idle mappings have nothing to update.
+  [[nodiscard]] auto IsEvaluationOngoing() const {
+    return evaluation_ongoing_;
+  }
+
+  //! Time, after the last update, until the next update can change the state of
+  //! the ongoing evaluation if no input is received in the meantime. Zero when
+  //! the mapping must be updated at every frame, and `Duration::max()` when
+  //! only an input can change its state.
+  [[nodiscard]] auto GetWakeUpDelay() const {
+    return wake_up_delay_;
+  }
+
 private:
   [[nodiscard]] auto DoUpdate(Duration delta_time) -> bool;
 
@@ -51,6 +65,8 @@ private:
   const platform::InputSlot &slot_;
   std::vector<std::shared_ptr<ActionTrigger>> triggers_;
 
+  Duration wake_up_delay_{0};
+
   ActionValue action_value_;
   ActionValue last_action_value_;
   bool evaluation_ongoing_{false};
@@ -6,7 +6,9 @@
 
 #include "oxygen/input/input_mapping_context.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 
 #include "oxygen/logging/logging.h"
 #include "oxygen/platform/input.h"
@@ -15,6 +17,7 @@
 #include "oxygen/input/action.h"
 #include "oxygen/input/input_action_mapping.h"
 
+using oxygen::SubPixelMotion;
 using oxygen::input::InputMappingContext;
 using oxygen::platform::InputEvent;
 using oxygen::platform::InputSlot;
@@ -33,80 +36,156 @@ InputMappingContext::InputMappingContext(std::string name)
 
 void InputMappingContext::AddMapping(
     std::shared_ptr<InputActionMapping> mapping) {
+  // A mapping also receives the events of the slots it is derived from, when
+  // the event values concern it. For example, a MouseX mapping receives the
+  // MouseXY events with a horizontal motion.
+  const auto index = static_cast<uint32_t>(mappings_.size());
+  const auto &slot = mapping->GetSlot();
+  AddRoute(slot, index, RouteCondition::kAlways);
+  if (slot == InputSlots::MouseX) {
+    AddRoute(InputSlots::MouseXY, index, RouteCondition::kMotionX);
+  } else if (slot == InputSlots::MouseY) {
+    AddRoute(InputSlots::MouseXY, index, RouteCondition::kMotionY);
+  } else if (slot == InputSlots::MouseWheelX) {
+    AddRoute(InputSlots::MouseWheelXY, index, RouteCondition::kWheelX);
+  } else if (slot == InputSlots::MouseWheelY) {
+    AddRoute(InputSlots::MouseWheelXY, index, RouteCondition::kWheelY);
+  } else if (slot == InputSlots::MouseWheelUp) {
+    AddRoute(InputSlots::MouseWheelXY, index, RouteCondition::kWheelUp);
+    AddRoute(InputSlots::MouseWheelY, index, RouteCondition::kWheelUp);
+  } else if (slot == InputSlots::MouseWheelDown) {
+    AddRoute(InputSlots::MouseWheelXY, index, RouteCondition::kWheelDown);
+    AddRoute(InputSlots::MouseWheelY, index, RouteCondition::kWheelDown);
+  } else if (slot == InputSlots::MouseWheelLeft) {
+    AddRoute(InputSlots::MouseWheelXY, index, RouteCondition::kWheelLeft);
+    AddRoute(InputSlots::MouseWheelX, index, RouteCondition::kWheelLeft);
+  } else if (slot == InputSlots::MouseWheelRight) {
+    AddRoute(InputSlots::MouseWheelXY, index, RouteCondition::kWheelRight);
+    AddRoute(InputSlots::MouseWheelX, index, RouteCondition::kWheelRight);
+  }
   mappings_.emplace_back(std::move(mapping));
+  states_.push_back(MappingState::kIdle);
+  last_update_.push_back(Duration::zero());
+  generations_.push_back(0);
 }
 
-namespace {
+void InputMappingContext::AddRoute(const InputSlot &event_slot,
+    const uint32_t mapping_index, const RouteCondition condition) {
+  routes_[event_slot].push_back(Route{
+      .mapping_index = mapping_index,
+      .condition = condition,
+  });
+}
 
-// NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
-auto SimilarSlots(const InputSlot &mapping_slot, const InputSlot &event_slot,
-    const InputEvent &event) {
-  if (event_slot == InputSlots::MouseXY) {
-    const auto &mm_event = dynamic_cast<const MouseMotionEvent &>(event);
-    return (mapping_slot == InputSlots::MouseX &&
-               std::abs(mm_event.GetMotion().dx) > 0) ||
-           (mapping_slot == InputSlots::MouseY &&
-               std::abs(mm_event.GetMotion().dy) > 0) ||
-           mapping_slot == InputSlots::MouseXY;
+auto InputMappingContext::Matches(
+    const RouteCondition condition, const SubPixelMotion &motion) -> bool {
+  switch (condition) {
+  case RouteCondition::kAlways:
+    return true;
+  case RouteCondition::kMotionX:
+  case RouteCondition::kWheelX:
+    return std::abs(motion.dx) > 0;
+  case RouteCondition::kMotionY:
+  case RouteCondition::kWheelY:
+    return std::abs(motion.dy) > 0;
+  case RouteCondition::kWheelUp:
+    return motion.dy > 0;
+  case RouteCondition::kWheelDown:
+    return motion.dy < 0;
+  case RouteCondition::kWheelLeft:
+    return motion.dx < 0;
+  case RouteCondition::kWheelRight:
+    return motion.dx > 0;
   }
-  if (event_slot == InputSlots::MouseWheelXY) {
-    const auto &mw_event = dynamic_cast<const MouseWheelEvent &>(event);
-    return mapping_slot == InputSlots::MouseWheelXY ||
-           (mapping_slot == InputSlots::MouseWheelY &&
-               std::abs(mw_event.GetScrollAmount().dy) > 0) ||
-           (mapping_slot == InputSlots::MouseWheelUp &&
-               mw_event.GetScrollAmount().dy > 0) ||
-           (mapping_slot == InputSlots::MouseWheelDown &&
-               mw_event.GetScrollAmount().dy < 0) ||
-           (mapping_slot == InputSlots::MouseWheelX &&
-               std::abs(mw_event.GetScrollAmount().dx) > 0) ||
-           (mapping_slot == InputSlots::MouseWheelLeft &&
-               mw_event.GetScrollAmount().dx < 0) ||
-           (mapping_slot == InputSlots::MouseWheelRight &&
-               mw_event.GetScrollAmount().dx > 0);
+  return false;
+}
+
+void InputMappingContext::HandleInput(
+    const InputSlot &slot, const InputEvent &event) {
+  const auto routes = routes_.find(slot);
+  if (routes == routes_.end()) {
+    return;
   }
-  if (event_slot == InputSlots::MouseWheelX) {
-    const auto &mw_event = dynamic_cast<const MouseWheelEvent &>(event);
-    return mapping_slot == InputSlots::MouseWheelX ||
-           (mapping_slot == InputSlots::MouseWheelLeft &&
-               mw_event.GetScrollAmount().dx < 0) ||
-           (mapping_slot == InputSlots::MouseWheelRight &&
-               mw_event.GetScrollAmount().dx > 0);
+
+  // The motion or scroll amount, only needed by the derived slots.
+  SubPixelMotion motion{.dx = 0.0F, .dy = 0.0F};
+  if (event.GetType() == platform::InputEventType::kMouseMotionEvent) {
+    motion = event.As<MouseMotionEvent>().GetMotion();
+  } else if (event.GetType() == platform::InputEventType::kMouseWheelEvent) {
+    motion = event.As<MouseWheelEvent>().GetScrollAmount();
   }
-  if (event_slot == InputSlots::MouseWheelY) {
-    const auto &mw_event = dynamic_cast<const MouseWheelEvent &>(event);
-    return mapping_slot == InputSlots::MouseWheelY ||
-           (mapping_slot == InputSlots::MouseWheelUp &&
-               mw_event.GetScrollAmount().dy > 0) ||
-           (mapping_slot == InputSlots::MouseWheelDown &&
-               mw_event.GetScrollAmount().dy < 0);
+
+  for (const auto &route : routes->second) {
+    if (!Matches(route.condition, motion)) {
+      continue;
+    }
+    const auto index = route.mapping_index;
+    mappings_[index]->HandleInput(event);
+    if (states_[index] == MappingState::kActive ||
+        !mappings_[index]->IsEvaluationOngoing()) {
+      continue;
+    }
+    // A parked mapping keeps the time of its last update, so that it receives
+    // the time elapsed while it was parked.
+    if (states_[index] == MappingState::kIdle) {
+      last_update_[index] = now_;
+    }
+    states_[index] = MappingState::kActive;
+    active_mappings_.push_back(index);
   }
-  return mapping_slot == event_slot;
 }
 
-} // namespace
+void InputMappingContext::Park(
+    const uint32_t mapping_index, const Duration delay) {
+  states_[mapping_index] = MappingState::kParked;
+  const auto generation = ++generations_[mapping_index];
+  if (delay != Duration::max()) {
+    timers_.Schedule(
+        (TimerWheel::TimerId{generation} << 32U) | mapping_index, now_ + delay);
+  }
+}
 
-void InputMappingContext::HandleInput(
-    const InputSlot &slot, const InputEvent &event) const {
-  // Iterate over all mapping contexts associated with the slot that had the
-  // input event.
-  for (const auto &mapping : mappings_) {
-    // Extrapolate the slot from platform to the action mapping slot based on
-    // the input values. For example if the platform gives us a MouseXY but the
-    // mapping is for MouseX, then we still call the mapping.
-    if (SimilarSlots(mapping->GetSlot(), slot, event)) {
-      mapping->HandleInput(event);
+void InputMappingContext::WakeUpExpired() {
+  expired_timers_.clear();
+  timers_.Advance(now_, expired_timers_);
+  for (const auto id : expired_timers_) {
+    const auto index = static_cast<uint32_t>(id);
+    const auto generation = static_cast<uint32_t>(id >> 32U);
+    if (states_[index] == MappingState::kParked &&
+        generations_[index] == generation) {
+      states_[index] = MappingState::kActive;
+      active_mappings_.push_back(index);
     }
   }
 }
 
-auto InputMappingContext::Update(Duration delta_time) const -> bool {
-  // Iterate over all mapping contexts associated with the slot that had the
-  // input event.
+auto InputMappingContext::Update(Duration delta_time) -> bool {
+  now_ += delta_time;
+  WakeUpExpired();
+
+  // Only the mappings with an ongoing evaluation need an update, in the order
+  // they were added, as it decides which ones are canceled when an action
+  // consumes the input.
+  std::ranges::sort(active_mappings_);
   bool input_consumed{false};
-  for (const auto &mapping : mappings_) {
+  for (size_t position = 0; position < active_mappings_.size(); ++position) {
+    const auto index = active_mappings_[position];
+    const auto &mapping = mappings_[index];
     if (!input_consumed) {
-      input_consumed = mapping->Update(delta_time);
+      input_consumed = mapping->Update(now_ - last_update_[index]);
+      last_update_[index] = now_;
+      if (input_consumed) {
+        // The parked mappings added after this one are canceled as well.
+        for (auto parked = index + 1; parked < states_.size(); ++parked) {
+          if (states_[parked] == MappingState::kParked) {
+            states_[parked] = MappingState::kActive;
+            active_mappings_.push_back(parked);
+          }
+        }
+        std::sort(active_mappings_.begin() +
+                      static_cast<std::ptrdiff_t>(position + 1),
+            active_mappings_.end());
+      }
     } else {
       ASDEBUG_TO_LOGGER(input_logger, "Cancel input for action: {}",
           mapping->GetAction()->GetName());
@@ -114,5 +193,21 @@ auto InputMappingContext::Update(Duration delta_time) const -> bool {
       mapping->CancelInput();
     }
   }
+
+  // Drop the mappings whose evaluation completed, and park the ones that have
+  // nothing to do until a deadline or an input.
+  std::erase_if(active_mappings_, [this](const uint32_t index) {
+    const auto &mapping = mappings_[index];
+    if (!mapping->IsEvaluationOngoing()) {
+      states_[index] = MappingState::kIdle;
+      return true;
+    }
+    const auto delay = mapping->GetWakeUpDelay();
+    if (delay < TimerWheel::kResolution) {
+      return false;
+    }
+    Park(index, delay);
+    return true;
+  });
   return input_consumed;
 }
@@ -6,13 +6,18 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "oxygen/base/types.h"
+#include "oxygen/platform/input.h"
 #include "oxygen/platform/types.h"
 
+#include "oxygen/input/timer_wheel.h"
+
 #include "types.h"
 
 namespace oxygen::input {
@@ -28,14 +33,69 @@ public:
   }
 
   void HandleInput(
-      const platform::InputSlot &slot, const platform::InputEvent &event) const;
+      const platform::InputSlot &slot, const platform::InputEvent &event);
 
-  [[nodiscard]] bool Update(Duration delta_time) const;
+  //! Update the mappings with an ongoing evaluation. Mappings whose triggers
+  //! only wait for a time threshold, like a hold or a pulse, are parked on a
+  //! timer and not updated until it expires or they receive an input, and do
+  //! not notify their action as ongoing at each frame in the meantime.
+  [[nodiscard]] bool Update(Duration delta_time);
 
 private:
+  // Condition on the event values for a mapping to receive an event from a
+  // slot other than its own, e.g. a MouseX mapping only receives the MouseXY
+  // events with a horizontal motion.
+  enum class RouteCondition : uint8_t {
+    kAlways,
+    kMotionX,
+    kMotionY,
+    kWheelX,
+    kWheelY,
+    kWheelUp,
+    kWheelDown,
+    kWheelLeft,
+    kWheelRight,
+  };
+  struct Route {
+    uint32_t mapping_index;
+    RouteCondition condition;
+  };
+
+  void AddRoute(const platform::InputSlot &event_slot, uint32_t mapping_index,
+      RouteCondition condition);
+  [[nodiscard]] static auto Matches(
+      RouteCondition condition, const SubPixelMotion &motion) -> bool;
+
   std::string name_;
 
   std::vector<std::shared_ptr<InputActionMapping>> mappings_;
+  // The mappings receiving the events of each slot, in the order they were
+  // added, with the derived slots already resolved.
+  std::unordered_map<platform::InputSlot, std::vector<Route>> routes_;
+  // Where a mapping is in its evaluation: idle, updated at every frame, or
+  // parked until its wake up timer expires or it receives an input.
+  enum class MappingState : uint8_t {
+    kIdle,
+    kActive,
+    kParked,
+  };
+
+  void Park(uint32_t mapping_index, Duration delay);
+  void WakeUpExpired();
+
+  // The indices of the mappings with an ongoing evaluation that need to be
+  // updated at the next frame, and the state of each mapping.
+  std::vector<uint32_t> active_mappings_;
+  std::vector<MappingState> states_;
+  // The time of the last update of each mapping, for the parked mappings to
+  // receive all the time elapsed since then when they wake up.
+  std::vector<Duration> last_update_;
+  // Incremented each time a mapping is parked, and stored in the upper half of
+  // the timer id, to ignore the timers of the previous times it was parked.
+  std::vector<uint32_t> generations_;
+  Duration now_{0};
+  TimerWheel timers_;
+  std::vector<TimerWheel::TimerId> expired_timers_;
 };
 
 } // namespace oxygen::input
@@ -46,13 +46,14 @@ InputSystem::InputSystem(Platform &platform) : platform_(platform) {
 }
 
 void InputSystem::ProcessInput(const platform::InputEvent &event) {
-  if (event.GetType() == platform::InputEventType::kKeyEvent) {
-    const auto &key_event = dynamic_cast<const platform::KeyEvent &>(event);
+  switch (event.GetType()) {
+  case platform::InputEventType::kKeyEvent: {
+    const auto &key_event = event.As<platform::KeyEvent>();
     const auto &slot = Platform::GetInputSlotForKey(key_event.GetKeyCode());
-    HandleInput(slot, key_event);
-  } else if (event.GetType() == platform::InputEventType::kMouseButtonEvent) {
-    const auto &mb_event =
-        dynamic_cast<const platform::MouseButtonEvent &>(event);
+    HandleInput(slot, event);
+  } break;
+  case platform::InputEventType::kMouseButtonEvent: {
+    const auto &mb_event = event.As<platform::MouseButtonEvent>();
     const InputSlot *slot{nullptr};
     switch (mb_event.GetButton()) {
     case platform::MouseButton::kLeft:
@@ -75,29 +76,30 @@ void InputSystem::ProcessInput(const platform::InputEvent &event) {
     }
     assert(slot != nullptr);
     if (slot != nullptr && *slot != InputSlots::None) {
-      HandleInput(*slot, mb_event);
+      HandleInput(*slot, event);
     }
-  } else if (event.GetType() == platform::InputEventType::kMouseMotionEvent) {
-    const auto &mm_event =
-        dynamic_cast<const platform::MouseMotionEvent &>(event);
+  } break;
+  case platform::InputEventType::kMouseMotionEvent: {
+    const auto &mm_event = event.As<platform::MouseMotionEvent>();
     if (std::abs(mm_event.GetMotion().dx) > 0 ||
         std::abs(mm_event.GetMotion().dy) > 0) {
-      HandleInput(InputSlots::MouseXY, mm_event);
+      HandleInput(InputSlots::MouseXY, event);
     }
-  } else if (event.GetType() == platform::InputEventType::kMouseWheelEvent) {
-    const auto &mw_event =
-        dynamic_cast<const platform::MouseWheelEvent &>(event);
+  } break;
+  case platform::InputEventType::kMouseWheelEvent: {
+    const auto &mw_event = event.As<platform::MouseWheelEvent>();
     if (abs(mw_event.GetScrollAmount().dx) > 0 &&
         abs(mw_event.GetScrollAmount().dy) > 0) {
-      HandleInput(InputSlots::MouseWheelXY, mw_event);
+      HandleInput(InputSlots::MouseWheelXY, event);
       return;
     }
     if (abs(mw_event.GetScrollAmount().dx) > 0) {
-      HandleInput(InputSlots::MouseWheelX, mw_event);
+      HandleInput(InputSlots::MouseWheelX, event);
     }
     if (abs(mw_event.GetScrollAmount().dy) > 0) {
-      HandleInput(InputSlots::MouseWheelY, mw_event);
+      HandleInput(InputSlots::MouseWheelY, event);
     }
+  } break;
   }
 }
 
@@ -0,0 +1,319 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "oxygen/input/input_mapping_context.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "oxygen/base/types.h"
+#include "oxygen/input/action.h"
+#include "oxygen/input/action_triggers.h"
+#include "oxygen/input/input_action_mapping.h"
+#include "oxygen/platform/input.h"
+#include "oxygen/platform/input_event.h"
+
+using oxygen::Duration;
+using oxygen::TimePoint;
+using oxygen::input::Action;
+using oxygen::input::ActionTrigger;
+using oxygen::input::ActionTriggerDown;
+using oxygen::input::ActionTriggerHold;
+using oxygen::input::ActionTriggerPressed;
+using oxygen::input::ActionValueType;
+using oxygen::input::InputActionMapping;
+using oxygen::input::InputMappingContext;
+using oxygen::platform::ButtonState;
+using oxygen::platform::InputEvent;
+using oxygen::platform::InputSlot;
+using oxygen::platform::InputSlots;
+using oxygen::platform::Key;
+using oxygen::platform::KeyEvent;
+using oxygen::platform::MouseMotionEvent;
+using oxygen::platform::MouseWheelEvent;
+
+using testing::Contains;
+using testing::ElementsAre;
+using testing::IsEmpty;
+using testing::IsFalse;
+using testing::IsTrue;
+using testing::Not;
+
+namespace {
+
+constexpr Duration kFrameDuration{std::chrono::milliseconds(10)};
+
+auto MakeKeyEvent(const Key key, const ButtonState state) {
+  return InputEvent(
+      nullptr, TimePoint{0}, KeyEvent(KeyEvent::KeyInfo(key), state));
+}
+
+auto MakeMotionEvent(const float dx, const float dy) {
+  return InputEvent(nullptr, TimePoint{0},
+      MouseMotionEvent({.x = 0.0F, .y = 0.0F}, {.dx = dx, .dy = dy}));
+}
+
+auto MakeWheelEvent(const float dx, const float dy) {
+  return InputEvent(nullptr, TimePoint{0},
+      MouseWheelEvent({.x = 0.0F, .y = 0.0F}, {.dx = dx, .dy = dy}));
+}
+
+auto MakeHold() {
+  auto hold = std::make_shared<ActionTriggerHold>();
+  hold->MakeExplicit();
+  hold->SetHoldDurationThreshold(0.1F);
+  return hold;
+}
+
+// A mapping context updated at a fixed frame rate, and the log of the events
+// of its actions, as "frame:action:event". Events notified while handling an
+// input are logged with the frame that will handle it.
+class InputMappingContextTest : public testing::Test {
+protected:
+  auto AddMapping(const std::string &name, const InputSlot &slot,
+      std::shared_ptr<ActionTrigger> trigger) -> std::shared_ptr<Action> {
+    auto action = std::make_shared<Action>(name, ActionValueType::kBool);
+    action->OnStarted().connect(
+        [this](const Action &the_action) { Log(the_action, "started"); });
+    action->OnTriggered().connect(
+        [this](const Action &the_action, const auto & /*value*/) {
+          Log(the_action, "triggered");
+        });
+    action->OnOngoing().connect(
+        [this](const Action &the_action) { Log(the_action, "ongoing"); });
+    action->OnCanceled().connect(
+        [this](const Action &the_action) { Log(the_action, "canceled"); });
+    action->OnCompleted().connect(
+        [this](const Action &the_action) { Log(the_action, "completed"); });
+    auto mapping = std::make_shared<InputActionMapping>(action, slot);
+    mapping->AddTrigger(std::move(trigger));
+    context_.AddMapping(mapping);
+    return action;
+  }
+
+  auto RunFrame() -> bool {
+    const auto input_consumed = context_.Update(kFrameDuration);
+    ++frame_;
+    return input_consumed;
+  }
+
+  void RunFrames(const int count) {
+    for (int index = 0; index < count; ++index) {
+      std::ignore = RunFrame();
+    }
+  }
+
+  // Take the log entries so far.
+  auto TakeLog() -> std::vector<std::string> {
+    return std::exchange(log_, {});
+  }
+
+  InputMappingContext context_{"test"};
+
+private:
+  void Log(const Action &action, const std::string &event) {
+    log_.push_back(
+        std::to_string(frame_) + ":" + action.GetName() + ":" + event);
+  }
+
+  int frame_{0};
+  std::vector<std::string> log_;
+};
+
+} // namespace
+
+// NOLINTNEXTLINE
+TEST_F(InputMappingContextTest, RoutesMouseEventsToTheDerivedSlots) {
+  AddMapping("xy", InputSlots::MouseXY, std::make_shared<ActionTriggerDown>());
+  AddMapping("x", InputSlots::MouseX, std::make_shared<ActionTriggerDown>());
+  AddMapping("y", InputSlots::MouseY, std::make_shared<ActionTriggerDown>());
+  AddMapping("wheel_y", InputSlots::MouseWheelY,
+      std::make_shared<ActionTriggerDown>());
+  AddMapping(
+      "up", InputSlots::MouseWheelUp, std::make_shared<ActionTriggerDown>());
+  AddMapping("down", InputSlots::MouseWheelDown,
+      std::make_shared<ActionTriggerDown>());
+  AddMapping("left", InputSlots::MouseWheelLeft,
+      std::make_shared<ActionTriggerDown>());
+
+  const auto started = [this]() {
+    std::ignore = RunFrame();
+    std::vector<std::string> names;
+    for (const auto &entry : TakeLog()) {
+      if (entry.ends_with(":started")) {
+        names.push_back(entry.substr(entry.find(':') + 1));
+      }
+    }
+    return names;
+  };
+
+  context_.HandleInput(InputSlots::MouseXY, MakeMotionEvent(2.0F, 0.0F));
+  EXPECT_THAT(started(), ElementsAre("xy:started", "x:started"));
+
+  context_.HandleInput(InputSlots::MouseXY, MakeMotionEvent(0.0F, -1.0F));
+  EXPECT_THAT(started(), ElementsAre("xy:started", "y:started"));
+
+  context_.HandleInput(InputSlots::MouseWheelXY, MakeWheelEvent(0.0F, 1.0F));
+  EXPECT_THAT(started(), ElementsAre("wheel_y:started", "up:started"));
+
+  context_.HandleInput(InputSlots::MouseWheelY, MakeWheelEvent(0.0F, -1.0F));
+  EXPECT_THAT(started(), ElementsAre("wheel_y:started", "down:started"));
+
+  context_.HandleInput(InputSlots::MouseWheelX, MakeWheelEvent(-1.0F, 0.0F));
+  EXPECT_THAT(started(), ElementsAre("left:started"));
+
+  context_.HandleInput(InputSlots::MouseWheelX, MakeWheelEvent(1.0F, 0.0F));
+  EXPECT_THAT(started(), IsEmpty());
+}
+
+// NOLINTNEXTLINE
+TEST_F(InputMappingContextTest, OnlyUpdatesTheMappingsWithOngoingEvaluation) {
+  auto down = std::make_shared<ActionTriggerDown>();
+  down->MakeExplicit();
+  AddMapping("down", InputSlots::A, down);
+  AddMapping("other", InputSlots::B, std::make_shared<ActionTriggerPressed>());
+
+  // Idle mappings are not updated.
+  RunFrames(2);
+  EXPECT_THAT(TakeLog(), IsEmpty());
+
+  // The mapping joins the updated ones with its first input, and stays there
+  // while its trigger is ongoing.
+  context_.HandleInput(
+      InputSlots::A, MakeKeyEvent(Key::kA, ButtonState::kPressed));
+  RunFrames(2);
+  EXPECT_THAT(TakeLog(),
+      ElementsAre("2:down:started", "2:down:triggered", "2:down:ongoing",
+          "3:down:triggered", "3:down:ongoing"));
+
+  // It leaves them when its evaluation completes.
+  context_.HandleInput(
+      InputSlots::A, MakeKeyEvent(Key::kA, ButtonState::kReleased));
+  RunFrames(3);
+  EXPECT_THAT(TakeLog(), ElementsAre("4:down:completed"));
+}
+
+// NOLINTNEXTLINE
+TEST_F(InputMappingContextTest, CancelsTheMappingsAfterAConsumingAction) {
+  AddMapping("first", InputSlots::A, std::make_shared<ActionTriggerPressed>());
+  const auto consumer = AddMapping(
+      "consumer", InputSlots::A, std::make_shared<ActionTriggerPressed>());
+  consumer->SetConsumesInput(true);
+  AddMapping("later", InputSlots::A, std::make_shared<ActionTriggerPressed>());
+  AddMapping("idle", InputSlots::B, std::make_shared<ActionTriggerPressed>());
+
+  context_.HandleInput(
+      InputSlots::A, MakeKeyEvent(Key::kA, ButtonState::kPressed));
+  EXPECT_THAT(RunFrame(), IsTrue());
+  // The mappings are updated in the order they were added, the ones after
+  // the consuming action are canceled, and the idle ones are not touched.
+  EXPECT_THAT(TakeLog(),
+      ElementsAre("0:first:started", "0:consumer:started", "0:later:started",
+          "0:first:triggered", "0:first:completed", "0:consumer:triggered",
+          "0:consumer:completed", "0:later:completed"));
+
+  EXPECT_THAT(RunFrame(), IsFalse());
+  EXPECT_THAT(TakeLog(), IsEmpty());
+}
+
+// NOLINTNEXTLINE
+TEST_F(InputMappingContextTest, ParkedHoldTriggersOnTheFrameItIsHeldFor) {
+  AddMapping("hold", InputSlots::H, MakeHold());
+
+  context_.HandleInput(
+      InputSlots::H, MakeKeyEvent(Key::kH, ButtonState::kPressed));
+  RunFrames(12);
+  // Held for 10 ms at each frame, the threshold is reached at the tenth one,
+  // and then again ten frames later.
+  EXPECT_THAT(TakeLog(),
+      ElementsAre("0:hold:started", "0:hold:ongoing", "9:hold:triggered",
+          "9:hold:ongoing"));
+}
+
+// NOLINTNEXTLINE
+TEST_F(InputMappingContextTest, ParkedMappingIsNotOngoingAtEachFrame) {
+  AddMapping("hold", InputSlots::H, MakeHold());
+
+  context_.HandleInput(
+      InputSlots::H, MakeKeyEvent(Key::kH, ButtonState::kPressed));
+  std::ignore = RunFrame();
+  EXPECT_THAT(TakeLog(), Contains("0:hold:ongoing"));
+
+  RunFrames(8);
+  EXPECT_THAT(TakeLog(), IsEmpty());
+}
+
+// NOLINTNEXTLINE
+TEST_F(InputMappingContextTest, InputWakesUpAParkedMappingWithTheElapsedTime) {
+  AddMapping("hold", InputSlots::H, MakeHold());
+
+  context_.HandleInput(
+      InputSlots::H, MakeKeyEvent(Key::kH, ButtonState::kPressed));
+  RunFrames(5);
+  // A repeated key press, the mapping is updated with the time since its
+  // last update, and the hold still triggers at the tenth frame.
+  context_.HandleInput(
+      InputSlots::H, MakeKeyEvent(Key::kH, ButtonState::kPressed));
+  RunFrames(5);
+  EXPECT_THAT(TakeLog(),
+      ElementsAre("0:hold:started", "0:hold:ongoing", "5:hold:ongoing",
+          "9:hold:triggered", "9:hold:ongoing"));
+}
+
+// NOLINTNEXTLINE
+TEST_F(InputMappingContextTest, CancelsParkedMappingsAfterAConsumingAction) {
+  const auto consumer = AddMapping(
+      "consumer", InputSlots::A, std::make_shared<ActionTriggerPressed>());
+  consumer->SetConsumesInput(true);
+  AddMapping("hold", InputSlots::H, MakeHold());
+  AddMapping("later", InputSlots::A, std::make_shared<ActionTriggerPressed>());
+
+  context_.HandleInput(
+      InputSlots::H, MakeKeyEvent(Key::kH, ButtonState::kPressed));
+  RunFrames(2);
+  std::ignore = TakeLog();
+
+  // The parked hold is canceled in its place, between the mappings that
+  // received the input.
+  context_.HandleInput(
+      InputSlots::A, MakeKeyEvent(Key::kA, ButtonState::kPressed));
+  EXPECT_THAT(RunFrame(), IsTrue());
+  EXPECT_THAT(TakeLog(),
+      ElementsAre("2:consumer:started", "2:later:started",
+          "2:consumer:triggered", "2:consumer:completed", "2:hold:completed",
+          "2:later:completed"));
+
+  // Its timer expires with nothing to wake up.
+  RunFrames(10);
+  EXPECT_THAT(TakeLog(), IsEmpty());
+}
+
+// NOLINTNEXTLINE
+TEST_F(InputMappingContextTest, IgnoresTheTimersOfAPreviousPark) {
+  AddMapping("hold", InputSlots::H, MakeHold());
+
+  context_.HandleInput(
+      InputSlots::H, MakeKeyEvent(Key::kH, ButtonState::kPressed));
+  RunFrames(3);
+  context_.HandleInput(
+      InputSlots::H, MakeKeyEvent(Key::kH, ButtonState::kReleased));
+  RunFrames(2);
+  context_.HandleInput(
+      InputSlots::H, MakeKeyEvent(Key::kH, ButtonState::kPressed));
+  RunFrames(12);
+  // The timer of the first press expires at the tenth frame, while the
+  // mapping is parked again, and does not wake it up.
+  const auto log = TakeLog();
+  EXPECT_THAT(log, Not(Contains("9:hold:ongoing")));
+  EXPECT_THAT(log, Contains("14:hold:triggered"));
+}
@@ -0,0 +1,194 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "oxygen/base/types.h"
+#include "oxygen/core/system.h"
+#include "oxygen/input/action.h"
+#include "oxygen/input/action_triggers.h"
+#include "oxygen/input/input_action_mapping.h"
+#include "oxygen/input/input_mapping_context.h"
+#include "oxygen/input/input_system.h"
+#include "oxygen/platform-null/platform.h"
+#include "oxygen/platform/input.h"
+#include "oxygen/platform/input_event.h"
+#include "oxygen/platform/input_recording.h"
+
+using oxygen::Duration;
+using oxygen::TimePoint;
+using oxygen::engine::SystemUpdateContext;
+using oxygen::input::Action;
+using oxygen::input::ActionTriggerHold;
+using oxygen::input::ActionTriggerTap;
+using oxygen::input::ActionValueType;
+using oxygen::input::InputActionMapping;
+using oxygen::input::InputMappingContext;
+using oxygen::input::InputSystem;
+using oxygen::platform::ButtonState;
+using oxygen::platform::InputEvent;
+using oxygen::platform::InputRecorder;
+using oxygen::platform::InputSlots;
+using oxygen::platform::Key;
+using oxygen::platform::KeyEvent;
+using oxygen::platform::ReadInputRecording;
+using oxygen::platform::null::Platform;
+using oxygen::platform::null::ReplayTiming;
+
+using testing::Contains;
+using testing::Eq;
+using testing::Not;
+
+namespace {
+
+// The input system of a game with a hold and a tap action, driven like the
+// engine drives it, and the log of the action events of each frame.
+class Session {
+public:
+  explicit Session(Platform &platform) : input_system_(platform) {
+    auto context = std::make_shared<InputMappingContext>("game");
+
+    auto hold = std::make_shared<ActionTriggerHold>();
+    hold->MakeExplicit();
+    hold->SetHoldDurationThreshold(0.1F);
+    AddAction(*context, "hold", Key::kH, hold);
+
+    auto tap = std::make_shared<ActionTriggerTap>();
+    tap->MakeExplicit();
+    tap->SetTapReleaseThreshold(0.2F);
+    AddAction(*context, "tap", Key::kT, tap);
+
+    input_system_.AddMappingContext(context, 0);
+    input_system_.ActivateMappingContext(context);
+  }
+
+  // Run a frame, which lasts the duration given by `frame_clock` once the
+  // events are polled, as in the engine loop.
+  void RunFrame(
+      Platform &platform, const std::function<Duration()> &frame_clock) {
+    platform.NewFrame();
+    std::vector<InputEvent> events(16);
+    events.resize(platform.PollEvents(events));
+    const auto frame_duration = frame_clock();
+    if (recorder_) {
+      recorder_->RecordFrame(frame_duration, events);
+    }
+    for (const auto &event : events) {
+      input_system_.ProcessInput(event);
+    }
+    update_context_.time_since_start += frame_duration;
+    update_context_.delta_time = frame_duration;
+    input_system_.Update(update_context_);
+    ++frame_;
+  }
+
+  void Record(std::ostream &out) {
+    recorder_ = std::make_unique<InputRecorder>(out);
+  }
+
+  [[nodiscard]] auto Log() const -> const std::vector<std::string> & {
+    return log_;
+  }
+
+private:
+  void AddAction(InputMappingContext &context, const std::string &name,
+      const Key key, std::shared_ptr<oxygen::input::ActionTrigger> trigger) {
+    auto action = std::make_shared<Action>(name, ActionValueType::kBool);
+    action->OnTriggered().connect(
+        [this](const Action &the_action, const auto & /*value*/) {
+          LogEvent(the_action, "triggered");
+        });
+    action->OnCompleted().connect([this](const Action &the_action) {
+      LogEvent(the_action, "completed");
+    });
+    auto mapping = std::make_shared<InputActionMapping>(
+        action, InputSlots::GetInputSlotForKey(key));
+    mapping->AddTrigger(std::move(trigger));
+    context.AddMapping(mapping);
+    input_system_.AddAction(action);
+  }
+
+  void LogEvent(const Action &action, const std::string &event) {
+    log_.push_back(
+        std::to_string(frame_) + ":" + action.GetName() + ":" + event);
+  }
+
+  InputSystem input_system_;
+  SystemUpdateContext update_context_{};
+  std::unique_ptr<InputRecorder> recorder_;
+  size_t frame_{0};
+  std::vector<std::string> log_;
+};
+
+auto MakeKeyEvent(
+    const TimePoint time, const Key key, const ButtonState state) {
+  return InputEvent(nullptr, time, KeyEvent(KeyEvent::KeyInfo(key), state));
+}
+
+} // namespace
+
+// NOLINTNEXTLINE
+TEST(InputReplayTest, ReplayReproducesTheTimedTriggers) {
+  // Irregular frames, as with a loaded machine, so that the time based
+  // triggers depend on the duration of each frame and not on their count.
+  const std::vector<Duration> frame_durations{Duration(16'667),
+      Duration(40'000), Duration(8'000), Duration(33'333), Duration(16'667),
+      Duration(50'000), Duration(16'667), Duration(25'000), Duration(16'667),
+      Duration(60'000), Duration(16'667), Duration(16'667), Duration(150'000),
+      Duration(16'667), Duration(16'667)};
+  // The frames before which the keys change: a hold of `H` long enough to
+  // trigger, a quick tap of `T`, then a press of `T` too long to be a tap.
+  const std::vector<std::tuple<size_t, Key, ButtonState>> script{
+      {1, Key::kH, ButtonState::kPressed},
+      {2, Key::kT, ButtonState::kPressed},
+      {4, Key::kT, ButtonState::kReleased},
+      {8, Key::kH, ButtonState::kReleased},
+      {9, Key::kT, ButtonState::kPressed},
+      {13, Key::kT, ButtonState::kReleased},
+  };
+
+  std::stringstream log;
+  std::vector<std::string> recorded;
+  {
+    Platform platform;
+    Session session(platform);
+    session.Record(log);
+    TimePoint now{0};
+    for (size_t frame = 0; frame < frame_durations.size(); ++frame) {
+      for (const auto &[at_frame, key, state] : script) {
+        if (at_frame == frame) {
+          platform.InjectEvent(MakeKeyEvent(now, key, state));
+        }
+      }
+      session.RunFrame(platform,
+          [&frame_durations, frame]() { return frame_durations[frame]; });
+      now += frame_durations[frame];
+    }
+    recorded = session.Log();
+  }
+  // The hold triggers once held for 100 ms, in the frame that crosses it.
+  EXPECT_THAT(recorded, Contains("5:hold:triggered"));
+  EXPECT_THAT(recorded, Contains("4:tap:triggered"));
+  EXPECT_THAT(recorded, Not(Contains("13:tap:triggered")));
+
+  Platform platform;
+  platform.Replay(ReadInputRecording(log), ReplayTiming::kAsFastAsPossible);
+  Session session(platform);
+  while (platform.IsReplaying()) {
+    // The engine does the same with `Engine::SetFrameClock()`.
+    session.RunFrame(
+        platform, [&platform]() { return platform.ReplayFrameDuration(); });
+  }
+  EXPECT_THAT(session.Log(), Eq(recorded));
+}
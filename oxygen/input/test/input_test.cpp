@@ -37,7 +37,12 @@ class MockPlatform : public Platform
   MOCK_METHOD(std::weak_ptr<oxygen::platform::Window>, MakeWindow, (std::string const&, oxygen::PixelExtent const&, oxygen::platform::Window::InitialFlags), (override));
   MOCK_METHOD(std::weak_ptr<oxygen::platform::Window>, MakeWindow, (std::string const&, oxygen::PixelPosition const&, oxygen::PixelExtent const&), (override));
   MOCK_METHOD(std::weak_ptr<oxygen::platform::Window>, MakeWindow, (std::string const&, oxygen::PixelPosition const&, oxygen::PixelExtent const&, oxygen::platform::Window::InitialFlags), (override));
-  MOCK_METHOD(std::unique_ptr<oxygen::platform::InputEvent>, PollEvent, (), (override));
+  MOCK_METHOD(std::optional<oxygen::platform::InputEvent>, PollEvent, (), (override));
+  MOCK_METHOD(size_t, PollEvents, (std::span<oxygen::platform::InputEvent>), (override));
+  MOCK_METHOD(void, NewFrame, (), (override));
+  MOCK_METHOD(size_t, DroppedEventCount, (), (const, override));
+  MOCK_METHOD(bool, WaitForEvents, (oxygen::Duration), (override));
+  MOCK_METHOD(void, Wake, (), (override));
   MOCK_METHOD(std::vector<const char*>, GetRequiredInstanceExtensions, (), (const, override));
   MOCK_METHOD(std::vector<std::unique_ptr<oxygen::platform::Display>>, Displays, (), (const, override));
   MOCK_METHOD(std::unique_ptr<oxygen::platform::Display>, DisplayFromId, (const oxygen::platform::Display::IdType&), (const, override));
@@ -0,0 +1,93 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "oxygen/input/timer_wheel.h"
+
+#include <chrono>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using oxygen::Duration;
+using oxygen::input::TimerWheel;
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+
+using testing::AllOf;
+using testing::ElementsAre;
+using testing::Eq;
+using testing::Ge;
+using testing::IsEmpty;
+using testing::Lt;
+
+// NOLINTNEXTLINE
+TEST(TimerWheelTest, ExpiresTimersAtTheirDeadline) {
+  TimerWheel wheel;
+  std::vector<TimerWheel::TimerId> expired;
+
+  wheel.Schedule(1, milliseconds(50));
+  wheel.Schedule(2, milliseconds(20));
+  wheel.Schedule(3, milliseconds(20));
+  EXPECT_THAT(wheel.Size(), Eq(3));
+
+  wheel.Advance(milliseconds(19), expired);
+  EXPECT_THAT(expired, IsEmpty());
+
+  wheel.Advance(milliseconds(33), expired);
+  EXPECT_THAT(expired, ElementsAre(2, 3));
+  EXPECT_THAT(wheel.Size(), Eq(1));
+
+  expired.clear();
+  wheel.Advance(milliseconds(50), expired);
+  EXPECT_THAT(expired, ElementsAre(1));
+  EXPECT_THAT(wheel.Size(), Eq(0));
+}
+
+// NOLINTNEXTLINE
+TEST(TimerWheelTest, ExpiresPastDeadlinesAtTheNextTick) {
+  TimerWheel wheel;
+  std::vector<TimerWheel::TimerId> expired;
+
+  wheel.Advance(milliseconds(100), expired);
+  wheel.Schedule(1, milliseconds(10));
+
+  wheel.Advance(milliseconds(100), expired);
+  EXPECT_THAT(expired, IsEmpty());
+  wheel.Advance(milliseconds(101), expired);
+  EXPECT_THAT(expired, ElementsAre(1));
+}
+
+// NOLINTNEXTLINE
+TEST(TimerWheelTest, CascadesFarDeadlines) {
+  TimerWheel wheel;
+  std::vector<TimerWheel::TimerId> expired;
+
+  wheel.Advance(milliseconds(7), expired);
+  wheel.Schedule(1, seconds(300));
+  wheel.Schedule(2, seconds(5));
+  wheel.Schedule(3, milliseconds(4100));
+
+  // Advance one frame at a time, recording when each timer expires.
+  std::vector<Duration> expired_at;
+  for (Duration now = milliseconds(7); now <= seconds(301);
+       now += milliseconds(16)) {
+    const auto before = expired.size();
+    wheel.Advance(now, expired);
+    for (auto count = before; count < expired.size(); ++count) {
+      expired_at.push_back(now);
+    }
+  }
+
+  EXPECT_THAT(expired, ElementsAre(3, 2, 1));
+  ASSERT_THAT(expired_at.size(), Eq(3));
+  EXPECT_THAT(expired_at[0],
+      AllOf(Ge(milliseconds(4100)), Lt(milliseconds(4100 + 16))));
+  EXPECT_THAT(expired_at[1],
+      AllOf(Ge(milliseconds(5000)), Lt(milliseconds(5000 + 16))));
+  EXPECT_THAT(expired_at[2],
+      AllOf(Ge(milliseconds(300000)), Lt(milliseconds(300000 + 16))));
+}
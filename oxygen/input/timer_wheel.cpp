@@ -0,0 +1,73 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "oxygen/input/timer_wheel.h"
+
+#include <algorithm>
+
+using oxygen::input::TimerWheel;
+
+void TimerWheel::Schedule(const TimerId id, const Duration deadline) {
+  const auto tick =
+      static_cast<uint64_t>(std::max(deadline, Duration::zero()) / kResolution);
+  Insert({.id = id, .tick = std::max(tick, current_tick_ + 1)});
+  ++size_;
+}
+
+void TimerWheel::Insert(const Timer &timer) {
+  // The level is the first one whose slots, relative to the current tick,
+  // reach the timer, the slot is the timer tick at the level granularity.
+  auto timer_tick = timer.tick;
+  const auto delta = timer_tick - current_tick_;
+  size_t level{0};
+  while (level < kLevels - 1 && delta >> (kSlotBits * (level + 1)) != 0) {
+    ++level;
+  }
+  if (delta >> (kSlotBits * kLevels) != 0) {
+    // Beyond the range of the wheel.
+    timer_tick = current_tick_ + (uint64_t{1} << (kSlotBits * kLevels)) - 1;
+  }
+  const auto slot = (timer_tick >> (kSlotBits * level)) & (kSlots - 1);
+  levels_[level][slot].push_back({.id = timer.id, .tick = timer_tick});
+}
+
+void TimerWheel::Cascade(const size_t level) {
+  const auto slot = (current_tick_ >> (kSlotBits * level)) & (kSlots - 1);
+  // Timers never move to the slot being emptied, it is swapped with an empty
+  // one to keep the memory of both.
+  cascading_.swap(levels_[level][slot]);
+  for (const auto &timer : cascading_) {
+    Insert(timer);
+  }
+  cascading_.clear();
+}
+
+void TimerWheel::Advance(const Duration now, std::vector<TimerId> &expired) {
+  const auto target = static_cast<uint64_t>(
+      std::max(now, Duration::zero()) / kResolution);
+  if (size_ == 0) {
+    current_tick_ = std::max(current_tick_, target);
+    return;
+  }
+  while (current_tick_ < target && size_ != 0) {
+    ++current_tick_;
+    // Move the timers of the higher levels down when the wheel enters their
+    // slot, starting from the highest so that they can cascade all the way.
+    for (auto level = kLevels - 1; level > 0; --level) {
+      const auto mask = (uint64_t{1} << (kSlotBits * level)) - 1;
+      if ((current_tick_ & mask) == 0) {
+        Cascade(level);
+      }
+    }
+    auto &slot = levels_[0][current_tick_ & (kSlots - 1)];
+    for (const auto &timer : slot) {
+      expired.push_back(timer.id);
+    }
+    size_ -= slot.size();
+    slot.clear();
+  }
+  current_tick_ = std::max(current_tick_, target);
+}
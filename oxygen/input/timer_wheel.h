@@ -0,0 +1,72 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "oxygen/base/types.h"
+
+namespace oxygen::input {
+
+/*!
+ Hierarchical timer wheel, waking up timers when their deadline passes, at a
+ cost that does not depend on the number of pending timers.
+
+ Time is counted in ticks of `kResolution`. The first level has a slot per tick
+ for the next 64 ticks, each following level has slots 64 times wider, and its
+ timers are moved down a level when the wheel reaches their slot. Deadlines
+ are rounded down to the resolution, so timers may expire up to one tick
+ early, never late. Deadlines beyond the range of the wheel, more than four
+ hours ahead, expire early at the end of the range.
+
+ There is no cancellation: owners recognize and ignore the timers they no
+ longer need when they expire, for example with a generation count in the id.
+*/
+class TimerWheel {
+public:
+  using TimerId = uint64_t;
+
+  static constexpr Duration kResolution{std::chrono::milliseconds(1)};
+
+  //! Add a timer expiring at `deadline`, on the same time line as `Advance()`.
+  //! Deadlines already reached expire at the next tick.
+  void Schedule(TimerId id, Duration deadline);
+
+  //! Move the wheel forward to `now`, and append to `expired` the ids of the
+  //! timers whose deadline is reached.
+  void Advance(Duration now, std::vector<TimerId> &expired);
+
+  //! Number of timers scheduled and not yet expired.
+  [[nodiscard]] auto Size() const {
+    return size_;
+  }
+
+private:
+  static constexpr size_t kLevels{4};
+  static constexpr unsigned kSlotBits{6};
+  static constexpr size_t kSlots{size_t{1} << kSlotBits};
+
+  struct Timer {
+    TimerId id;
+    uint64_t tick;
+  };
+  using Slot = std::vector<Timer>;
+
+  void Insert(const Timer &timer);
+  void Cascade(size_t level);
+
+  std::array<std::array<Slot, kSlots>, kLevels> levels_{};
+  Slot cascading_;
+  uint64_t current_tick_{0};
+  size_t size_{0};
+};
+
+} // namespace oxygen::input
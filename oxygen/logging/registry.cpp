@@ -14,7 +14,7 @@ auto oxygen::log::Registry::Instance() -> Registry & {
   return instance;
 }
 
-inline void oxygen::log::Registry::SetLogLevel(
+void oxygen::log::Registry::SetLogLevel(
     spdlog::level::level_enum log_level) const {
   pimpl_->SetLogLevel(log_level);
 }
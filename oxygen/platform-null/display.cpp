@@ -0,0 +1,41 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "display.h"
+
+#include <utility>
+
+using oxygen::platform::null::Display;
+
+Display::Display(const IdType display_id, DisplayInfo info, const bool primary)
+    : Base(display_id), info_(std::move(info)), primary_(primary) {
+}
+
+Display::~Display() = default;
+
+auto Display::IsPrimaryDisplay() const -> bool {
+  return primary_;
+}
+
+auto Display::Name() const -> std::string {
+  return info_.name;
+}
+
+auto Display::Bounds() const -> PixelBounds {
+  return info_.bounds;
+}
+
+auto Display::UsableBounds() const -> PixelBounds {
+  return info_.usable_bounds;
+}
+
+auto Display::Orientation() const -> DisplayOrientation {
+  return info_.orientation;
+}
+
+auto Display::ContentScale() const -> float {
+  return info_.content_scale;
+}
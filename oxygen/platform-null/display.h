@@ -0,0 +1,48 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <string>
+
+#include <oxygen/base/macros.h>
+#include <oxygen/base/types.h>
+#include <oxygen/platform/display.h>
+
+namespace oxygen::platform::null {
+
+//! Properties of a simulated display.
+struct DisplayInfo {
+  std::string name{"Null Display"};
+  PixelBounds bounds{{.x = 0, .y = 0}, {.width = 1920, .height = 1080}};
+  PixelBounds usable_bounds{{.x = 0, .y = 0}, {.width = 1920, .height = 1080}};
+  DisplayOrientation orientation{DisplayOrientation::kLandscape};
+  float content_scale{1.0F};
+};
+
+class Display final : public platform::Display {
+  using Base = platform::Display;
+
+public:
+  Display(IdType display_id, DisplayInfo info, bool primary);
+  ~Display() override;
+
+  OXYGEN_MAKE_NON_COPYABLE(Display)
+  OXYGEN_MAKE_NON_MOVEABLE(Display)
+
+  [[nodiscard]] auto IsPrimaryDisplay() const -> bool override;
+  [[nodiscard]] auto Name() const -> std::string override;
+  [[nodiscard]] auto Bounds() const -> PixelBounds override;
+  [[nodiscard]] auto UsableBounds() const -> PixelBounds override;
+  [[nodiscard]] auto Orientation() const -> DisplayOrientation override;
+  [[nodiscard]] auto ContentScale() const -> float override;
+
+private:
+  DisplayInfo info_;
+  bool primary_;
+};
+
+} // namespace oxygen::platform::null
@@ -0,0 +1,356 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "platform.h"
+
+#include <algorithm>
+#include <cstddef>
+
+#include "oxygen/base/time.h"
+#include "oxygen/logging/logging.h"
+#include "oxygen/platform/input_event.h"
+
+#include "window.h"
+
+namespace {
+auto &platform_logger = // NOLINT(*-avoid-non-const-global-variables)
+    oxygen::log::Registry::Instance().GetLogger("Oxygen.Platform");
+}
+
+using oxygen::Time;
+using oxygen::TimePoint;
+using oxygen::platform::null::Platform;
+
+Platform::Platform() : Platform(std::vector{DisplayInfo{}}) {
+}
+
+Platform::Platform(std::vector<DisplayInfo> displays) {
+  for (auto &display : displays) {
+    displays_.emplace_back(next_display_id_++, std::move(display));
+  }
+  ASLOG_TO_LOGGER(platform_logger, info, "Platform/Null initialized");
+}
+
+Platform::~Platform() {
+  windows_.clear();
+  ASLOG_TO_LOGGER(platform_logger, info, "Platform/Null destroyed");
+}
+
+auto Platform::GetRequiredInstanceExtensions() const
+    -> std::vector<const char *> {
+  return {};
+}
+
+auto Platform::MakeWindow(std::string const &title,
+    PixelExtent const &extent) -> std::weak_ptr<platform::Window> {
+  return MakeWindow(title, extent, {});
+}
+
+auto Platform::MakeWindow(std::string const &title, PixelExtent const &extent,
+    platform::Window::InitialFlags flags) -> std::weak_ptr<platform::Window> {
+  // Centered on the primary display, as with the other platforms.
+  PixelPosition position{.x = 0, .y = 0};
+  if (!displays_.empty()) {
+    const auto &bounds = displays_.front().second.bounds;
+    position = {
+        .x = bounds.origin.x + (bounds.extent.width - extent.width) / 2,
+        .y = bounds.origin.y + (bounds.extent.height - extent.height) / 2,
+    };
+  }
+  return AddWindow(title, position, extent, flags);
+}
+
+auto Platform::MakeWindow(std::string const &title,
+    PixelPosition const &position,
+    PixelExtent const &extent) -> std::weak_ptr<platform::Window> {
+  return AddWindow(title, position, extent, {});
+}
+
+auto Platform::MakeWindow(std::string const &title,
+    PixelPosition const &position, PixelExtent const &extent,
+    platform::Window::InitialFlags flags) -> std::weak_ptr<platform::Window> {
+  return AddWindow(title, position, extent, flags);
+}
+
+auto Platform::AddWindow(std::string const &title,
+    PixelPosition const &position, PixelExtent const &extent,
+    platform::Window::InitialFlags flags) -> std::weak_ptr<platform::Window> {
+  auto new_window = std::make_shared<Window>(next_window_id_++, title,
+      position, extent, flags, [this](const WindowIdType window_id) {
+        {
+          const std::lock_guard lock(mutex_);
+          closing_.push_back(window_id);
+          has_pending_.store(true, std::memory_order_release);
+        }
+        event_available_.notify_all();
+      });
+  windows_.push_back(new_window);
+  return new_window;
+}
+
+void Platform::CloseWindow(const WindowIdType window_id) {
+  const auto the_window = std::ranges::find_if(windows_,
+      [window_id](auto &window) { return window->Id() == window_id; });
+  if (the_window == windows_.end()) {
+    // Requested to close more than once.
+    return;
+  }
+  ASLOG_TO_LOGGER(
+      platform_logger, info, "Window [id = {}] is closing", window_id);
+  OnWindowClosed()(**the_window);
+  ASLOG_TO_LOGGER(
+      platform_logger, info, "Window [id = {}] is closed", window_id);
+
+  windows_.erase(the_window);
+
+  if (windows_.empty()) {
+    OnLastWindowClosed()();
+  }
+}
+
+auto Platform::Displays() const
+    -> std::vector<std::unique_ptr<platform::Display>> {
+  std::vector<std::unique_ptr<platform::Display>> displays;
+  displays.reserve(displays_.size());
+  for (size_t index = 0; index < displays_.size(); ++index) {
+    const auto &[display_id, info] = displays_[index];
+    displays.emplace_back(
+        std::make_unique<Display>(display_id, info, index == 0));
+  }
+  return displays;
+}
+
+auto Platform::DisplayFromId(const platform::Display::IdType &display_id) const
+    -> std::unique_ptr<platform::Display> {
+  const auto found =
+      std::ranges::find_if(displays_, [display_id](const auto &display) {
+        return display.first == display_id;
+      });
+  if (found == displays_.end()) {
+    return {};
+  }
+  return std::make_unique<Display>(
+      display_id, found->second, found == displays_.begin());
+}
+
+auto Platform::AddDisplay(DisplayInfo info) -> Display::IdType {
+  const auto display_id = next_display_id_++;
+  displays_.emplace_back(display_id, std::move(info));
+  OnDisplayConnected()(display_id);
+  return display_id;
+}
+
+auto Platform::RemoveDisplay(const Display::IdType display_id) -> bool {
+  if (std::erase_if(displays_, [display_id](const auto &display) {
+        return display.first == display_id;
+      }) == 0) {
+    return false;
+  }
+  OnDisplayDisconnected()(display_id);
+  return true;
+}
+
+auto Platform::SetDisplayOrientation(const Display::IdType display_id,
+    const DisplayOrientation orientation) -> bool {
+  const auto found =
+      std::ranges::find_if(displays_, [display_id](const auto &display) {
+        return display.first == display_id;
+      });
+  if (found == displays_.end()) {
+    return false;
+  }
+  found->second.orientation = orientation;
+  OnDisplayOrientationChanged()(display_id);
+  return true;
+}
+
+void Platform::InjectEvent(const platform::InputEvent &event) {
+  {
+    const std::lock_guard lock(mutex_);
+    pending_.push_back(event);
+    has_pending_.store(true, std::memory_order_release);
+  }
+  event_available_.notify_all();
+}
+
+void Platform::ScheduleEvent(const platform::InputEvent &event) {
+  Schedule(event.GetTime(), event);
+}
+
+void Platform::Schedule(
+    const TimePoint time, const platform::InputEvent &event) {
+  {
+    const std::lock_guard lock(mutex_);
+    scheduled_.emplace(time, event);
+    UpdateNextScheduled();
+  }
+  event_available_.notify_all();
+}
+
+void Platform::Replay(InputRecording recording, const ReplayTiming timing) {
+  auto &events = recording.events;
+  if (timing == ReplayTiming::kRecorded) {
+    if (events.empty()) {
+      return;
+    }
+    const auto first_time = events.front().event.GetTime();
+    const auto start = Time::Now();
+    for (const auto &[frame, event] : events) {
+      Schedule(start + (event.GetTime() - first_time), event);
+    }
+    replay_end_ = start + (events.back().event.GetTime() - first_time);
+    return;
+  }
+  replay_.assign(events.begin(), events.end());
+  replay_frame_durations_ = std::move(recording.frame_durations);
+  replay_frame_ = 0;
+  replay_frame_duration_ = Duration::zero();
+  replay_time_ = Duration::zero();
+}
+
+auto Platform::IsReplaying() const -> bool {
+  return !replay_.empty() || replay_frame_ < replay_frame_durations_.size() ||
+         Time::Now() < replay_end_;
+}
+
+void Platform::ReleaseDueEvents(const TimePoint now) {
+  if (scheduled_.empty() || scheduled_.begin()->first > now) {
+    return;
+  }
+  const auto end = scheduled_.upper_bound(now);
+  for (auto entry = scheduled_.begin(); entry != end; ++entry) {
+    pending_.push_back(entry->second);
+  }
+  scheduled_.erase(scheduled_.begin(), end);
+  has_pending_.store(true, std::memory_order_release);
+  UpdateNextScheduled();
+}
+
+void Platform::UpdateNextScheduled() {
+  next_scheduled_.store(scheduled_.empty()
+                            ? TimePoint::max().count()
+                            : scheduled_.begin()->first.count(),
+      std::memory_order_release);
+}
+
+auto Platform::PollEvent() -> std::optional<platform::InputEvent> {
+  const auto next_scheduled = next_scheduled_.load(std::memory_order_acquire);
+  if (!has_pending_.load(std::memory_order_acquire) &&
+      (next_scheduled == TimePoint::max().count() ||
+          Time::Now().count() < next_scheduled)) {
+    return {};
+  }
+
+  std::unique_lock lock(mutex_);
+  ReleaseDueEvents(Time::Now());
+  if (!closing_.empty()) {
+    const auto window_id = closing_.front();
+    closing_.erase(closing_.begin());
+    has_pending_.store(!pending_.empty() || !closing_.empty(),
+        std::memory_order_release);
+    // Closing the window emits signals, which may inject events.
+    lock.unlock();
+    CloseWindow(window_id);
+    return {};
+  }
+  std::optional<platform::InputEvent> event;
+  if (!pending_.empty()) {
+    event = pending_.front();
+    pending_.pop_front();
+  }
+  has_pending_.store(!pending_.empty(), std::memory_order_release);
+  return event;
+}
+
+auto Platform::PollEvents(std::span<platform::InputEvent> events) -> size_t {
+  const auto next_scheduled = next_scheduled_.load(std::memory_order_acquire);
+  if (!has_pending_.load(std::memory_order_acquire) &&
+      (next_scheduled == TimePoint::max().count() ||
+          Time::Now().count() < next_scheduled)) {
+    return 0;
+  }
+
+  size_t count{0};
+  std::vector<WindowIdType> closing;
+  {
+    const std::lock_guard lock(mutex_);
+    ReleaseDueEvents(Time::Now());
+    count = std::min(events.size(), pending_.size());
+    const auto end = pending_.begin() + static_cast<std::ptrdiff_t>(count);
+    std::copy(pending_.begin(), end, events.begin());
+    pending_.erase(pending_.begin(), end);
+    closing.swap(closing_);
+    has_pending_.store(!pending_.empty(), std::memory_order_release);
+  }
+  // Closing the windows emits signals, which may inject events.
+  std::ranges::for_each(
+      closing, [this](const auto window_id) { CloseWindow(window_id); });
+  return count;
+}
+
+void Platform::NewFrame() {
+  // Injected events have no raw event to release, only the next frame of the
+  // replay has something to do.
+  if (replay_.empty() && replay_frame_ >= replay_frame_durations_.size()) {
+    replay_frame_duration_ = Duration::zero();
+    return;
+  }
+  replay_frame_duration_ = replay_frame_ < replay_frame_durations_.size()
+                               ? replay_frame_durations_[replay_frame_]
+                               : Duration::zero();
+  replay_time_ += replay_frame_duration_;
+  {
+    const std::lock_guard lock(mutex_);
+    while (!replay_.empty() && replay_.front().frame <= replay_frame_) {
+      pending_.push_back(replay_.front().event);
+      replay_.pop_front();
+      has_pending_.store(true, std::memory_order_release);
+    }
+  }
+  ++replay_frame_;
+}
+
+auto Platform::DroppedEventCount() const -> size_t {
+  return 0;
+}
+
+auto Platform::WaitForEvents(const Duration timeout) -> bool {
+  const auto start = Time::Now();
+  auto deadline = TimePoint::max();
+  if (timeout >= Duration::zero() && timeout < TimePoint::max() - start) {
+    deadline = start + timeout;
+  }
+
+  std::unique_lock lock(mutex_);
+  while (true) {
+    const auto now = Time::Now();
+    ReleaseDueEvents(now);
+    if (!pending_.empty() || !closing_.empty()) {
+      return true;
+    }
+    if (wake_requested_ || now >= deadline) {
+      wake_requested_ = false;
+      return false;
+    }
+    auto wake_up = deadline;
+    if (!scheduled_.empty()) {
+      wake_up = std::min(wake_up, scheduled_.begin()->first);
+    }
+    if (wake_up == TimePoint::max()) {
+      event_available_.wait(lock);
+    } else {
+      event_available_.wait_for(lock, wake_up - now);
+    }
+  }
+}
+
+void Platform::Wake() {
+  {
+    std::lock_guard lock(mutex_);
+    wake_requested_ = true;
+  }
+  event_available_.notify_all();
+}
@@ -0,0 +1,175 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "oxygen/base/macros.h"
+#include "oxygen/platform-null/display.h"
+#include "oxygen/platform/input_recording.h"
+#include "oxygen/platform/platform.h"
+
+namespace oxygen::platform::null {
+
+class Window;
+
+//! How `Platform::Replay()` delivers the recorded events.
+enum class ReplayTiming : uint8_t {
+  //! Each event is delivered at its recorded time, relative to the first one
+  //! and to the start of the replay.
+  kRecorded,
+  //! The events recorded in a frame are delivered by the polls following the
+  //! matching call to `NewFrame()`, without waiting. Time only advances on the
+  //! virtual clock of the replay, by the recorded duration of each frame.
+  kAsFastAsPossible,
+};
+
+/*!
+ Platform without any windowing system, for dedicated servers, tests and
+ benchmarks running on hosts without a display.
+
+ Windows and displays are simulated: they only hold their state. Input events
+ are injected by the application, either to be delivered by the next poll, or
+ scheduled at their time stamp, to replay a scripted sequence. Events can be
+ injected from any thread; everything else must be called from the thread
+ running the engine loop.
+
+ Polling when nothing was injected costs two atomic loads, so that the engine
+ loop can run at full speed.
+*/
+class Platform final : public oxygen::Platform {
+public:
+  //! Starts with one primary display, with the default `DisplayInfo`.
+  Platform();
+  explicit Platform(std::vector<DisplayInfo> displays);
+  ~Platform() override;
+
+  OXYGEN_MAKE_NON_COPYABLE(Platform)
+  OXYGEN_MAKE_NON_MOVEABLE(Platform)
+
+  [[nodiscard]] auto
+  GetRequiredInstanceExtensions() const -> std::vector<const char *> override;
+
+  auto MakeWindow(std::string const &title,
+      PixelExtent const &extent) -> std::weak_ptr<platform::Window> override;
+  auto MakeWindow(std::string const &title, PixelExtent const &extent,
+      platform::Window::InitialFlags flags)
+      -> std::weak_ptr<platform::Window> override;
+  auto MakeWindow(std::string const &title, PixelPosition const &position,
+      PixelExtent const &extent) -> std::weak_ptr<platform::Window> override;
+  auto MakeWindow(std::string const &title, PixelPosition const &position,
+      PixelExtent const &extent, platform::Window::InitialFlags flags)
+      -> std::weak_ptr<platform::Window> override;
+
+  [[nodiscard]] auto
+  Displays() const -> std::vector<std::unique_ptr<platform::Display>> override;
+
+  [[nodiscard]] auto DisplayFromId(const Display::IdType &display_id) const
+      -> std::unique_ptr<platform::Display> override;
+
+  auto PollEvent() -> std::optional<platform::InputEvent> override;
+  auto PollEvents(std::span<platform::InputEvent> events) -> size_t override;
+  void NewFrame() override;
+  //! Injected events are never dropped.
+  [[nodiscard]] auto DroppedEventCount() const -> size_t override;
+  auto WaitForEvents(Duration timeout) -> bool override;
+  void Wake() override;
+
+  // -- Simulation -------------------------------------------------------------
+
+  //! Deliver `event` with the next poll.
+  void InjectEvent(const platform::InputEvent &event);
+  //! Deliver `event` with the first poll at or after its time stamp, relative
+  //! to `Time::Now()`. Events with the same time stamp keep their order.
+  void ScheduleEvent(const platform::InputEvent &event);
+
+  //! Replay events recorded by an `InputRecorder`, in addition to the injected
+  //! ones. Replayed events keep their recorded time stamps.
+  void Replay(InputRecording recording, ReplayTiming timing);
+  //! `true` until the last event of a `kRecorded` replay is due, or until the
+  //! last recorded frame of a `kAsFastAsPossible` replay is started.
+  [[nodiscard]] auto IsReplaying() const -> bool;
+
+  /*!
+   Recorded duration of the frame started by the last call to `NewFrame()`
+   during a `kAsFastAsPossible` replay, zero before and after the replay.
+
+   The engine must use it as its frame duration, for the systems, such as the
+   input triggers, to see the same time as in the recorded session:
+
+   \code
+   engine.SetFrameClock(
+       [&platform]() { return platform.ReplayFrameDuration(); });
+   \endcode
+  */
+  [[nodiscard]] auto ReplayFrameDuration() const -> Duration {
+    return replay_frame_duration_;
+  }
+  //! Virtual clock of a `kAsFastAsPossible` replay, the sum of the recorded
+  //! durations of the frames started so far.
+  [[nodiscard]] auto ReplayTime() const -> Duration {
+    return replay_time_;
+  }
+
+  //! Connect a display, the signal is emitted immediately.
+  auto AddDisplay(DisplayInfo info) -> Display::IdType;
+  //! Disconnect a display, the signal is emitted immediately.
+  auto RemoveDisplay(Display::IdType display_id) -> bool;
+  auto SetDisplayOrientation(
+      Display::IdType display_id, DisplayOrientation orientation) -> bool;
+
+private:
+  auto AddWindow(std::string const &title, PixelPosition const &position,
+      PixelExtent const &extent, platform::Window::InitialFlags flags)
+      -> std::weak_ptr<platform::Window>;
+  void CloseWindow(WindowIdType window_id);
+  //! Move the scheduled events that are due to the pending ones. Must be
+  //! called with the mutex locked.
+  void ReleaseDueEvents(TimePoint now);
+  void Schedule(TimePoint time, const platform::InputEvent &event);
+  void UpdateNextScheduled();
+
+  std::vector<std::shared_ptr<null::Window>> windows_;
+  WindowIdType next_window_id_{1};
+  std::vector<std::pair<Display::IdType, DisplayInfo>> displays_;
+  Display::IdType next_display_id_{1};
+
+  std::mutex mutex_;
+  std::condition_variable event_available_;
+  std::deque<platform::InputEvent> pending_;
+  std::multimap<TimePoint, platform::InputEvent> scheduled_;
+  // Windows requested to close, closed by the next poll.
+  std::vector<WindowIdType> closing_;
+  // Set by `Wake()`, cleared by the wait it interrupts.
+  bool wake_requested_{false};
+  // Lock-free view of the queues, for polls with nothing to deliver.
+  std::atomic<bool> has_pending_{false};
+  std::atomic<TimePoint::rep> next_scheduled_{TimePoint::max().count()};
+
+  // Events of the `kAsFastAsPossible` replay not delivered yet, and the
+  // recorded frame durations.
+  std::deque<RecordedInputEvent> replay_;
+  std::vector<Duration> replay_frame_durations_;
+  uint64_t replay_frame_{0};
+  Duration replay_frame_duration_{0};
+  Duration replay_time_{0};
+  // When the last event of a `kRecorded` replay is due.
+  TimePoint replay_end_{0};
+};
+
+} // namespace oxygen::platform::null
@@ -0,0 +1,229 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "oxygen/platform-null/platform.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "oxygen/base/time.h"
+#include "oxygen/platform/input_event.h"
+#include "oxygen/platform/window.h"
+
+using oxygen::Duration;
+using oxygen::PixelExtent;
+using oxygen::Time;
+using oxygen::TimePoint;
+using oxygen::platform::ButtonState;
+using oxygen::platform::DisplayOrientation;
+using oxygen::platform::InputEvent;
+using oxygen::platform::InputEventType;
+using oxygen::platform::Key;
+using oxygen::platform::KeyEvent;
+using oxygen::platform::Window;
+using oxygen::platform::null::DisplayInfo;
+using oxygen::platform::null::Platform;
+using oxygen::platform::null::ReplayTiming;
+
+using testing::Eq;
+using testing::IsFalse;
+using testing::IsNull;
+using testing::IsTrue;
+using testing::NotNull;
+using testing::SizeIs;
+
+using namespace std::chrono_literals;
+
+namespace {
+auto MakeKeyEvent(const oxygen::TimePoint time, const Key key) {
+  return InputEvent(
+      nullptr, time, KeyEvent(KeyEvent::KeyInfo(key), ButtonState::kPressed));
+}
+} // namespace
+
+// NOLINTNEXTLINE
+TEST(NullPlatformTest, PollsInjectedEventsInOrder) {
+  Platform platform;
+  platform.InjectEvent(MakeKeyEvent(Time::Now(), Key::kA));
+  platform.InjectEvent(MakeKeyEvent(Time::Now(), Key::kB));
+
+  platform.InjectEvent(MakeKeyEvent(Time::Now(), Key::kC));
+
+  std::vector<InputEvent> events(2);
+  ASSERT_THAT(platform.PollEvents(events), Eq(2));
+  EXPECT_THAT(events[0].GetType(), Eq(InputEventType::kKeyEvent));
+  EXPECT_THAT(events[0].As<KeyEvent>().GetKeyCode(), Eq(Key::kA));
+  EXPECT_THAT(events[1].As<KeyEvent>().GetKeyCode(), Eq(Key::kB));
+
+  // What did not fit is kept for the next poll.
+  ASSERT_THAT(platform.PollEvents(events), Eq(1));
+  EXPECT_THAT(events[0].As<KeyEvent>().GetKeyCode(), Eq(Key::kC));
+
+  EXPECT_THAT(platform.PollEvents(events), Eq(0));
+  EXPECT_THAT(platform.PollEvent().has_value(), IsFalse());
+}
+
+// NOLINTNEXTLINE
+TEST(NullPlatformTest, DeliversScheduledEventsAtTheirTime) {
+  Platform platform;
+  platform.ScheduleEvent(MakeKeyEvent(Time::Now() + Duration(20ms), Key::kB));
+  platform.ScheduleEvent(MakeKeyEvent(Time::Now(), Key::kA));
+
+  auto event = platform.PollEvent();
+  ASSERT_THAT(event.has_value(), IsTrue());
+  EXPECT_THAT(event->As<KeyEvent>().GetKeyCode(), Eq(Key::kA));
+  EXPECT_THAT(platform.PollEvent().has_value(), IsFalse());
+
+  EXPECT_THAT(platform.WaitForEvents(Duration(1s)), IsTrue());
+  event = platform.PollEvent();
+  ASSERT_THAT(event.has_value(), IsTrue());
+  EXPECT_THAT(event->As<KeyEvent>().GetKeyCode(), Eq(Key::kB));
+}
+
+// NOLINTNEXTLINE
+TEST(NullPlatformTest, WaitsForInjectedEvents) {
+  Platform platform;
+  EXPECT_THAT(platform.WaitForEvents(Duration(1ms)), IsFalse());
+
+  std::thread injector([&platform]() {
+    std::this_thread::sleep_for(5ms);
+    platform.InjectEvent(MakeKeyEvent(Time::Now(), Key::kA));
+  });
+  EXPECT_THAT(platform.WaitForEvents(Duration(-1)), IsTrue());
+  injector.join();
+  EXPECT_THAT(platform.PollEvent().has_value(), IsTrue());
+}
+
+// NOLINTNEXTLINE
+TEST(NullPlatformTest, ReplaysFrameByFrameAsFastAsPossible) {
+  Platform platform;
+  EXPECT_THAT(platform.ReplayFrameDuration(), Eq(Duration::zero()));
+  platform.Replay(
+      {
+          .frame_durations = {Duration(1'000), Duration(16'000),
+              Duration(8'000)},
+          .events =
+              {
+                  {.frame = 0,
+                      .event = MakeKeyEvent(TimePoint{1'000}, Key::kA)},
+                  {.frame = 2,
+                      .event = MakeKeyEvent(TimePoint{9'000}, Key::kB)},
+              },
+      },
+      ReplayTiming::kAsFastAsPossible);
+  EXPECT_THAT(platform.IsReplaying(), IsTrue());
+
+  std::vector<InputEvent> events(2);
+  platform.NewFrame();
+  ASSERT_THAT(platform.PollEvents(events), Eq(1));
+  EXPECT_THAT(events[0].As<KeyEvent>().GetKeyCode(), Eq(Key::kA));
+  EXPECT_THAT(platform.ReplayFrameDuration(), Eq(Duration(1'000)));
+  EXPECT_THAT(platform.ReplayTime(), Eq(Duration(1'000)));
+
+  // Frames without events still advance the virtual clock.
+  platform.NewFrame();
+  EXPECT_THAT(platform.PollEvents(events), Eq(0));
+  EXPECT_THAT(platform.ReplayFrameDuration(), Eq(Duration(16'000)));
+  EXPECT_THAT(platform.ReplayTime(), Eq(Duration(17'000)));
+
+  platform.NewFrame();
+  ASSERT_THAT(platform.PollEvents(events), Eq(1));
+  EXPECT_THAT(events[0].As<KeyEvent>().GetKeyCode(), Eq(Key::kB));
+  // Replayed events keep their recorded time stamps.
+  EXPECT_THAT(events[0].GetTime(), Eq(TimePoint{9'000}));
+  EXPECT_THAT(platform.ReplayFrameDuration(), Eq(Duration(8'000)));
+  EXPECT_THAT(platform.ReplayTime(), Eq(Duration(25'000)));
+  EXPECT_THAT(platform.IsReplaying(), IsFalse());
+
+  platform.NewFrame();
+  EXPECT_THAT(platform.ReplayFrameDuration(), Eq(Duration::zero()));
+}
+
+// NOLINTNEXTLINE
+TEST(NullPlatformTest, ReplaysAtTheRecordedTiming) {
+  Platform platform;
+  platform.Replay(
+      {
+          .frame_durations = {Duration(1'000), Duration(20'000)},
+          .events =
+              {
+                  {.frame = 0,
+                      .event = MakeKeyEvent(TimePoint{1'000}, Key::kA)},
+                  {.frame = 1,
+                      .event = MakeKeyEvent(TimePoint{21'000}, Key::kB)},
+              },
+      },
+      ReplayTiming::kRecorded);
+
+  auto event = platform.PollEvent();
+  ASSERT_THAT(event.has_value(), IsTrue());
+  EXPECT_THAT(event->As<KeyEvent>().GetKeyCode(), Eq(Key::kA));
+  EXPECT_THAT(platform.PollEvent().has_value(), IsFalse());
+
+  EXPECT_THAT(platform.WaitForEvents(Duration(1s)), IsTrue());
+  event = platform.PollEvent();
+  ASSERT_THAT(event.has_value(), IsTrue());
+  EXPECT_THAT(event->As<KeyEvent>().GetKeyCode(), Eq(Key::kB));
+  EXPECT_THAT(platform.IsReplaying(), IsFalse());
+}
+
+// NOLINTNEXTLINE
+TEST(NullPlatformTest, ClosesWindowsOnTheNextPoll) {
+  Platform platform;
+  int closed{0};
+  bool last_closed{false};
+  platform.OnWindowClosed().connect(
+      [&closed](const auto & /*window*/) { ++closed; });
+  platform.OnLastWindowClosed().connect(
+      [&last_closed]() { last_closed = true; });
+
+  Window::InitialFlags flags{};
+  flags.resizable = true;
+  const auto window = platform
+                          .MakeWindow("test",
+                              PixelExtent{.width = 800, .height = 600}, flags)
+                          .lock();
+  ASSERT_THAT(window, NotNull());
+  EXPECT_THAT(window->Position().x, Eq((1920 - 800) / 2));
+  window->Size(PixelExtent{.width = 640, .height = 480});
+  EXPECT_THAT(window->Size().width, Eq(640));
+
+  window->RequestClose();
+  EXPECT_THAT(closed, Eq(0));
+  std::vector<InputEvent> events(1);
+  platform.PollEvents(events);
+  EXPECT_THAT(closed, Eq(1));
+  EXPECT_THAT(last_closed, IsTrue());
+}
+
+// NOLINTNEXTLINE
+TEST(NullPlatformTest, SimulatesDisplays) {
+  Platform platform;
+  ASSERT_THAT(platform.Displays(), SizeIs(1));
+  EXPECT_THAT(platform.Displays()[0]->IsPrimaryDisplay(), IsTrue());
+
+  oxygen::platform::Display::IdType connected{0};
+  platform.OnDisplayConnected().connect(
+      [&connected](const auto display_id) { connected = display_id; });
+  const auto display_id = platform.AddDisplay(DisplayInfo{
+      .name = "Second",
+      .orientation = DisplayOrientation::kPortrait,
+  });
+  EXPECT_THAT(connected, Eq(display_id));
+
+  const auto display = platform.DisplayFromId(display_id);
+  ASSERT_THAT(display, NotNull());
+  EXPECT_THAT(display->Name(), Eq("Second"));
+  EXPECT_THAT(display->IsPrimaryDisplay(), IsFalse());
+  EXPECT_THAT(display->Orientation(), Eq(DisplayOrientation::kPortrait));
+
+  EXPECT_THAT(platform.RemoveDisplay(display_id), IsTrue());
+  EXPECT_THAT(platform.DisplayFromId(display_id), IsNull());
+}
@@ -0,0 +1,164 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "window.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "oxygen/logging/logging.h"
+
+namespace {
+auto &platform_logger = // NOLINT(*-avoid-non-const-global-variables)
+    oxygen::log::Registry::Instance().GetLogger("Oxygen.Platform");
+}
+
+using oxygen::platform::null::Window;
+
+namespace {
+auto Clamp(const int value, const int minimum, const int maximum) {
+  // A zero limit means no limit.
+  auto clamped = std::max(value, minimum);
+  if (maximum != 0) {
+    clamped = std::min(clamped, maximum);
+  }
+  return clamped;
+}
+} // namespace
+
+Window::Window(const WindowIdType window_id, std::string title,
+    const PixelPosition &position, const PixelExtent &extent,
+    const InitialFlags &flags, CloseHandler on_close)
+    : id_(window_id), title_(std::move(title)), position_(position),
+      extent_(extent), hidden_(flags.hidden),
+      always_on_top_(flags.always_on_top), full_screen_(flags.full_screen),
+      maximized_(flags.maximized), minimized_(flags.minimized),
+      resizable_(flags.resizable), borderless_(flags.borderless),
+      on_close_(std::move(on_close)) {
+  ASLOG_TO_LOGGER(platform_logger, info, "Null Window[{}] created", Id());
+}
+
+Window::~Window() {
+  ASLOG_TO_LOGGER(platform_logger, info, "Null Window[{}] destroyed", Id());
+}
+
+auto Window::Id() const -> oxygen::platform::WindowIdType {
+  return id_;
+}
+
+auto Window::NativeWindow() const -> oxygen::platform::NativeWindowInfo {
+  return {};
+}
+
+void Window::Show() {
+  hidden_ = false;
+}
+
+void Window::Hide() {
+  hidden_ = true;
+}
+
+void Window::FullScreen(const bool full_screen) {
+  full_screen_ = full_screen;
+}
+
+auto Window::IsFullScreen() const -> bool {
+  return full_screen_;
+}
+
+void Window::DoMaximize() {
+  maximized_ = true;
+  minimized_ = false;
+  OnMaximized()();
+}
+
+auto Window::IsMaximized() const -> bool {
+  return maximized_;
+}
+
+void Window::Minimize() {
+  minimized_ = true;
+  OnMinimized()();
+}
+
+auto Window::IsMinimized() const -> bool {
+  return minimized_;
+}
+
+void Window::DoRestore() {
+  maximized_ = false;
+  minimized_ = false;
+  OnRestored()();
+}
+
+void Window::DoResize(const PixelExtent &extent) {
+  extent_ = {
+      .width = Clamp(
+          extent.width, minimum_extent_.width, maximum_extent_.width),
+      .height = Clamp(
+          extent.height, minimum_extent_.height, maximum_extent_.height),
+  };
+  OnResized()(extent_);
+}
+
+auto Window::Size() const -> oxygen::PixelExtent {
+  return extent_;
+}
+
+void Window::MinimumSize(const PixelExtent &extent) {
+  minimum_extent_ = extent;
+}
+
+void Window::MaximumSize(const PixelExtent &extent) {
+  maximum_extent_ = extent;
+}
+
+void Window::Resizable(const bool resizable) {
+  resizable_ = resizable;
+}
+
+auto Window::IsResizable() const -> bool {
+  return resizable_;
+}
+
+auto Window::IsBorderLess() const -> bool {
+  return borderless_;
+}
+
+void Window::DoPosition(const PixelPosition &position) {
+  position_ = position;
+}
+
+auto Window::Position() const -> oxygen::PixelPosition {
+  return position_;
+}
+
+void Window::Title(const std::string &title) {
+  title_ = title;
+}
+
+auto Window::Title() const -> std::string {
+  return title_;
+}
+
+void Window::Activate() {
+  hidden_ = false;
+  minimized_ = false;
+}
+
+void Window::AlwaysOnTop(const bool always_on_top) {
+  always_on_top_ = always_on_top;
+}
+
+void Window::ProcessCloseRequest(bool /*force*/) {
+  if (on_close_) {
+    on_close_(Id());
+  }
+}
+
+auto Window::GetFrameBufferSize() const -> oxygen::PixelExtent {
+  return extent_;
+}
@@ -0,0 +1,100 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include <oxygen/base/macros.h>
+#include <oxygen/platform/types.h>
+#include <oxygen/platform/window.h>
+
+namespace oxygen::platform::null {
+
+//! A window that only exists as its state. Changes are applied immediately,
+//! and the corresponding window signals are emitted synchronously.
+class Window final : public oxygen::platform::Window {
+  using Base = oxygen::platform::Window;
+
+public:
+  //! Called when the window is requested to close, for the platform to close
+  //! it on its next poll, like a windowing system would.
+  using CloseHandler = std::function<void(WindowIdType)>;
+
+  Window(WindowIdType window_id, std::string title,
+      PixelPosition const &position, PixelExtent const &extent,
+      InitialFlags const &flags, CloseHandler on_close);
+
+  ~Window() override;
+
+  OXYGEN_MAKE_NON_COPYABLE(Window)
+  OXYGEN_MAKE_NON_MOVEABLE(Window)
+
+  [[nodiscard]] auto Id() const -> WindowIdType override;
+  [[nodiscard]] auto NativeWindow() const -> NativeWindowInfo override;
+
+  // Visibility
+  auto Show() -> void override;
+  auto Hide() -> void override;
+  [[nodiscard]] auto IsHidden() const -> bool {
+    return hidden_;
+  }
+
+  // Size
+  auto FullScreen(bool full_screen) -> void override;
+  [[nodiscard]] auto IsFullScreen() const -> bool override;
+  [[nodiscard]] auto IsMaximized() const -> bool override;
+  auto Minimize() -> void override;
+  [[nodiscard]] auto IsMinimized() const -> bool override;
+  [[nodiscard]] auto Size() const -> PixelExtent override;
+  auto MinimumSize(PixelExtent const &extent) -> void override;
+  auto MaximumSize(PixelExtent const &extent) -> void override;
+  auto Resizable(bool resizable) -> void override;
+  [[nodiscard]] auto IsResizable() const -> bool override;
+  [[nodiscard]] auto IsBorderLess() const -> bool override;
+
+  // Position
+  [[nodiscard]] auto Position() const -> PixelPosition override;
+
+  // Decorations
+  auto Title(std::string const &title) -> void override;
+  [[nodiscard]] auto Title() const -> std::string override;
+
+  // Input Focus
+  auto Activate() -> void override;
+  auto AlwaysOnTop(bool always_on_top) -> void override;
+
+  [[nodiscard]] auto GetFrameBufferSize() const -> PixelExtent override;
+
+protected:
+  // Size
+  auto DoMaximize() -> void override;
+  auto DoRestore() -> void override;
+  auto DoResize(PixelExtent const &extent) -> void override;
+  // Position
+  auto DoPosition(PixelPosition const &position) -> void override;
+
+  auto ProcessCloseRequest(bool force) -> void override;
+
+private:
+  WindowIdType id_;
+  std::string title_;
+  PixelPosition position_;
+  PixelExtent extent_;
+  PixelExtent minimum_extent_{};
+  PixelExtent maximum_extent_{};
+  bool hidden_;
+  bool always_on_top_;
+  bool full_screen_;
+  bool maximized_;
+  bool minimized_;
+  bool resizable_;
+  bool borderless_;
+  CloseHandler on_close_;
+};
+
+} // namespace oxygen::platform::null
@@ -105,7 +105,10 @@ public:
   // ---------------------------------------------------------------------------
 
   virtual auto PollEvent(SDL_Event *event) const -> bool = 0;
+  virtual auto WaitEventTimeout(
+      SDL_Event *event, int32_t timeout_ms) const -> bool = 0;
   virtual void PushEvent(SDL_Event *event) const = 0;
+  [[nodiscard]] virtual auto RegisterEvents(int count) const -> uint32_t = 0;
 
   // -- Display management
   // -----------------------------------------------------
@@ -307,10 +310,22 @@ public:
     return SDL_PollEvent(event);
   }
 
+  auto WaitEventTimeout(
+      SDL_Event *event, const int32_t timeout_ms) const -> bool override {
+    return SDL_WaitEventTimeout(event, timeout_ms);
+  }
+
   void PushEvent(SDL_Event *event) const override {
     SdlCheck(SDL_PushEvent(event));
   }
 
+  [[nodiscard]] auto RegisterEvents(
+      const int count) const -> uint32_t override {
+    const auto first = SDL_RegisterEvents(count);
+    SdlCheck(first != 0);
+    return first;
+  }
+
   auto GetDisplays(int *count) const -> SDL_DisplayID * override {
     auto *displays = SDL_GetDisplays(count);
     SdlCheck(displays != nullptr);
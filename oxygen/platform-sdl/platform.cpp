@@ -10,8 +10,11 @@
 #include <cassert>
 #include <chrono>
 #include <cstddef>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <span>
+#include <stdexcept>
 
 #include <oxygen/base/compilers.h>
 // Disable compiler and linter warnings originating from 'fmt' and for which we
@@ -192,7 +195,7 @@ auto MapKeyCode(SDL_Keycode code) {
 }
 
 auto TranslateKeyboardEvent(
-    SDL_Event const &event) -> std::unique_ptr<InputEvent> {
+    SDL_Event const &event) -> std::optional<InputEvent> {
   const auto key_code = MapKeyCode(event.key.key);
   if (key_code == Key::kNone) {
     // This is not a key code we are interested to handle.
@@ -209,11 +212,11 @@ auto TranslateKeyboardEvent(
   const ButtonState button_state =
       event.key.down ? ButtonState::kPressed : ButtonState::kReleased;
 
-  auto key_event = std::make_unique<KeyEvent>(&event,
+  InputEvent key_event(&event,
       std::chrono::duration_cast<oxygen::TimePoint>(
           std::chrono::nanoseconds(event.key.timestamp)),
-      key_info, button_state);
-  key_event->SetWindowId(event.key.windowID);
+      KeyEvent(key_info, button_state));
+  key_event.SetWindowId(event.key.windowID);
 
   return key_event;
 }
@@ -233,7 +236,7 @@ auto MapMouseButton(auto button) {
 }
 
 auto TranslateMouseButtonEvent(
-    const SDL_Event &event) -> std::unique_ptr<InputEvent> {
+    const SDL_Event &event) -> std::optional<InputEvent> {
   const auto button = MapMouseButton(event.button.button);
   if (button == MouseButton::kNone) {
     // This is not a mouse button we are interested to handle.
@@ -248,52 +251,55 @@ auto TranslateMouseButtonEvent(
   const ButtonState button_state =
       event.button.down ? ButtonState::kPressed : ButtonState::kReleased;
 
-  auto button_event = std::make_unique<MouseButtonEvent>(&event,
+  InputEvent button_event(&event,
       std::chrono::duration_cast<oxygen::TimePoint>(
           std::chrono::nanoseconds(event.button.timestamp)),
-      SubPixelPosition{
-          .x = event.button.x,
-          .y = event.button.y,
-      },
-      button, button_state);
-  button_event->SetWindowId(event.key.windowID);
+      MouseButtonEvent(
+          SubPixelPosition{
+              .x = event.button.x,
+              .y = event.button.y,
+          },
+          button, button_state));
+  button_event.SetWindowId(event.key.windowID);
   return button_event;
 }
 
 auto TranslateMouseMotionEvent(
-    const SDL_Event &event) -> std::unique_ptr<InputEvent> {
-  auto motion_event = std::make_unique<MouseMotionEvent>(&event,
+    const SDL_Event &event) -> std::optional<InputEvent> {
+  InputEvent motion_event(&event,
       std::chrono::duration_cast<oxygen::TimePoint>(
           std::chrono::nanoseconds(event.motion.timestamp)),
-      SubPixelPosition{
-          .x = event.motion.x,
-          .y = event.motion.y,
-      },
-      SubPixelMotion{
-          .dx = event.motion.xrel,
-          .dy = event.motion.yrel,
-      });
-  motion_event->SetWindowId(event.key.windowID);
+      MouseMotionEvent(
+          SubPixelPosition{
+              .x = event.motion.x,
+              .y = event.motion.y,
+          },
+          SubPixelMotion{
+              .dx = event.motion.xrel,
+              .dy = event.motion.yrel,
+          }));
+  motion_event.SetWindowId(event.key.windowID);
   return motion_event;
 }
 
 auto TranslateMouseWheelEvent(
-    const SDL_Event &event) -> std::unique_ptr<InputEvent> {
+    const SDL_Event &event) -> std::optional<InputEvent> {
   const auto direction =
       event.wheel.direction == SDL_MOUSEWHEEL_NORMAL ? 1.0F : -1.0F;
 
-  auto wheel_event = std::make_unique<MouseWheelEvent>(&event,
+  InputEvent wheel_event(&event,
       std::chrono::duration_cast<oxygen::TimePoint>(
           std::chrono::nanoseconds(event.wheel.timestamp)),
-      SubPixelPosition{
-          .x = event.wheel.mouse_x,
-          .y = event.wheel.mouse_y,
-      },
-      SubPixelMotion{
-          .dx = direction * event.wheel.x,
-          .dy = direction * event.wheel.y,
-      });
-  wheel_event->SetWindowId(event.key.windowID);
+      MouseWheelEvent(
+          SubPixelPosition{
+              .x = event.wheel.mouse_x,
+              .y = event.wheel.mouse_y,
+          },
+          SubPixelMotion{
+              .dx = direction * event.wheel.x,
+              .dy = direction * event.wheel.y,
+          }));
+  wheel_event.SetWindowId(event.key.windowID);
   return wheel_event;
 }
 } // namespace
@@ -303,6 +309,7 @@ Platform::Platform(std::shared_ptr<detail::WrapperInterface> sdl_wrapper)
                        : std::make_shared<detail::Wrapper>()) {
   sdl_->Init(SDL_INIT_VIDEO);
   sdl_->SetHint(SDL_HINT_QUIT_ON_LAST_WINDOW_CLOSE, "0");
+  wake_event_type_ = sdl_->RegisterEvents(1);
   ASLOG_TO_LOGGER(platform_logger, info, "Platform/SDL3 initialized");
 }
 
@@ -393,50 +400,128 @@ auto Platform::DisplayFromId(const platform::Display::IdType &display_id) const
   return display;
 }
 
-auto Platform::PollEvent() -> std::unique_ptr<platform::InputEvent> {
-  if (sdl_->PollEvent(&event_)) {
-    if (event_.type == SDL_EVENT_KEY_UP || event_.type == SDL_EVENT_KEY_DOWN) {
-      ASDEBUG_TO_LOGGER(platform_logger,
-          "Keyboard event type = {} window id = {} repeat = {} keysim.scancode "
-          "= {} keysim.keycode = {} key name = {}",
-          ((event_.key.type == SDL_EVENT_KEY_UP) ? "KEY_UP" : "KEY_DOWN"),
-          event_.key.windowID, event_.key.repeat, (uint32_t)event_.key.scancode,
-          (uint32_t)event_.key.key, sdl_->GetKeyName(event_.key.key));
-      return TranslateKeyboardEvent(event_);
-    }
-    if (event_.type == SDL_EVENT_MOUSE_BUTTON_UP ||
-        event_.type == SDL_EVENT_MOUSE_BUTTON_DOWN) {
-      ASDEBUG_TO_LOGGER(platform_logger,
-          "Mouse button event button = {} state = {}", event_.button.button,
-          ((event_.button.type == SDL_EVENT_MOUSE_BUTTON_UP) ? "UP" : "DOWN"));
-      return TranslateMouseButtonEvent(event_);
-    }
-    if (event_.type == SDL_EVENT_MOUSE_WHEEL) {
-      ASDEBUG_TO_LOGGER(platform_logger, "Mouse wheel event dx = {} dy = {}",
-          event_.wheel.x, event_.wheel.y);
-      return TranslateMouseWheelEvent(event_);
-    }
-    if (event_.type == SDL_EVENT_MOUSE_MOTION) {
-      ASDEBUG_TO_LOGGER(platform_logger, "Mouse motion event dx = {} dy = {}",
-          event_.motion.xrel, event_.motion.yrel);
-      return TranslateMouseMotionEvent(event_);
-    }
+auto Platform::PollEvent() -> std::optional<platform::InputEvent> {
+  // One event at a time, its raw event remains valid until the next poll,
+  // unless the frame also drained events in bulk, whose raw events must remain
+  // valid until the frame boundary.
+  if (!batch_polled_) {
+    events_.Release();
+  }
+  PumpEvents();
+  platform::InputEvent event;
+  if (events_.Pop({&event, 1}) == 1) {
+    return event;
+  }
+  return {};
+}
 
-    if (event_.type >= SDL_EVENT_DISPLAY_FIRST &&
-        event_.type <= SDL_EVENT_DISPLAY_LAST) {
-      DispatchDisplayEvent(event_);
-    } else if (event_.type >= SDL_EVENT_WINDOW_FIRST &&
-               event_.type <= SDL_EVENT_WINDOW_LAST) {
-      DispatchWindowEvent(event_);
-    } else if (event_.type == SDL_EVENT_POLL_SENTINEL) {
-      // Signals the end of an event poll cycle
-    } else {
-      if (event_.type != SDL_EVENT_MOUSE_MOTION) {
-        ASDEBUG_TO_LOGGER(platform_logger, "Event [{}] has no dispatcher",
-            detail::SdlEventName(event_.type));
-      }
-      OnUnhandledEvent()(event_);
+auto Platform::PollEvents(std::span<platform::InputEvent> events) -> size_t {
+  PumpEvents();
+  batch_polled_ = true;
+  return events_.Pop(events);
+}
+
+void Platform::NewFrame() {
+  events_.Release();
+  batch_polled_ = false;
+}
+
+auto Platform::DroppedEventCount() const -> size_t {
+  return events_.DroppedCount();
+}
+
+void Platform::PumpEvents() {
+  const auto drained = events_.Pump(
+      [this](SDL_Event &event) { return sdl_->PollEvent(&event); },
+      [this](const SDL_Event &event) { return TranslateEvent(event); });
+  if (!drained) {
+    ASDEBUG_TO_LOGGER(platform_logger,
+        "Event queue is full, remaining events left in the SDL queue");
+  }
+}
+
+auto Platform::WaitForEvents(const Duration timeout) -> bool {
+  if (events_.Size() != 0) {
+    return true;
+  }
+  int32_t timeout_ms{-1};
+  if (timeout >= Duration::zero()) {
+    // Rounded up, to not wake up before the timeout.
+    const auto milliseconds =
+        std::chrono::ceil<std::chrono::milliseconds>(timeout).count();
+    timeout_ms = static_cast<int32_t>(std::min<int64_t>(
+        milliseconds, std::numeric_limits<int32_t>::max()));
+  }
+  // Without an event to fill, the pending event stays in the queue.
+  return sdl_->WaitEventTimeout(nullptr, timeout_ms);
+}
+
+void Platform::Wake() {
+  SDL_Event event{
+      .user{
+          .type = wake_event_type_,
+          .reserved = 0,
+          .timestamp = SDL_GetTicksNS(),
+          .windowID = 0,
+          .code = 0,
+          .data1 = nullptr,
+          .data2 = nullptr,
+      },
+  };
+  try {
+    sdl_->PushEvent(&event);
+  } catch (const std::runtime_error &error) {
+    // The SDL queue is full, the wait ends anyway.
+    ASLOG_TO_LOGGER(platform_logger, warn, "Wake up event not pushed: {}",
+        error.what());
+  }
+}
+
+auto Platform::TranslateEvent(
+    SDL_Event const &event) -> std::optional<platform::InputEvent> {
+  if (event.type == SDL_EVENT_KEY_UP || event.type == SDL_EVENT_KEY_DOWN) {
+    ASDEBUG_TO_LOGGER(platform_logger,
+        "Keyboard event type = {} window id = {} repeat = {} keysim.scancode "
+        "= {} keysim.keycode = {} key name = {}",
+        ((event.key.type == SDL_EVENT_KEY_UP) ? "KEY_UP" : "KEY_DOWN"),
+        event.key.windowID, event.key.repeat, (uint32_t)event.key.scancode,
+        (uint32_t)event.key.key, sdl_->GetKeyName(event.key.key));
+    return TranslateKeyboardEvent(event);
+  }
+  if (event.type == SDL_EVENT_MOUSE_BUTTON_UP ||
+      event.type == SDL_EVENT_MOUSE_BUTTON_DOWN) {
+    ASDEBUG_TO_LOGGER(platform_logger,
+        "Mouse button event button = {} state = {}", event.button.button,
+        ((event.button.type == SDL_EVENT_MOUSE_BUTTON_UP) ? "UP" : "DOWN"));
+    return TranslateMouseButtonEvent(event);
+  }
+  if (event.type == SDL_EVENT_MOUSE_WHEEL) {
+    ASDEBUG_TO_LOGGER(platform_logger, "Mouse wheel event dx = {} dy = {}",
+        event.wheel.x, event.wheel.y);
+    return TranslateMouseWheelEvent(event);
+  }
+  if (event.type == SDL_EVENT_MOUSE_MOTION) {
+    ASDEBUG_TO_LOGGER(platform_logger, "Mouse motion event dx = {} dy = {}",
+        event.motion.xrel, event.motion.yrel);
+    return TranslateMouseMotionEvent(event);
+  }
+
+  if (event.type >= SDL_EVENT_DISPLAY_FIRST &&
+      event.type <= SDL_EVENT_DISPLAY_LAST) {
+    DispatchDisplayEvent(event);
+  } else if (event.type >= SDL_EVENT_WINDOW_FIRST &&
+             event.type <= SDL_EVENT_WINDOW_LAST) {
+    DispatchWindowEvent(event);
+  } else if (event.type == SDL_EVENT_POLL_SENTINEL) {
+    // Signals the end of an event poll cycle
+  } else if (event.type == wake_event_type_) {
+    // Only meant to end `WaitForEvents()`
+  } else {
+    if (event.type != SDL_EVENT_MOUSE_MOTION) {
+      ASDEBUG_TO_LOGGER(platform_logger, "Event [{}] has no dispatcher",
+          detail::SdlEventName(event.type));
     }
+    OnUnhandledEvent()(event);
   }
   return {};
 }
@@ -6,11 +6,15 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <optional>
+#include <span>
 #include <vector>
 
 #include "SDL3/SDL_events.h"
 #include "oxygen/base/macros.h"
+#include "oxygen/platform/event_queue.h"
 #include "oxygen/platform/platform.h"
 
 union SDL_Event;
@@ -49,7 +53,12 @@ public:
   [[nodiscard]] auto DisplayFromId(const Display::IdType &display_id) const
       -> std::unique_ptr<platform::Display> override;
 
-  auto PollEvent() -> std::unique_ptr<platform::InputEvent> override;
+  auto PollEvent() -> std::optional<platform::InputEvent> override;
+  auto PollEvents(std::span<platform::InputEvent> events) -> size_t override;
+  void NewFrame() override;
+  [[nodiscard]] auto DroppedEventCount() const -> size_t override;
+  auto WaitForEvents(Duration timeout) -> bool override;
+  void Wake() override;
 
   [[nodiscard]] auto OnUnhandledEvent() -> auto & {
     return on_unhandled_event_;
@@ -60,10 +69,23 @@ private:
       WindowIdType window_id) const -> platform::Window &;
   void DispatchDisplayEvent(SDL_Event const &event);
   void DispatchWindowEvent(SDL_Event const &event);
-
-  SDL_Event event_{};
+  auto TranslateEvent(
+      SDL_Event const &event) -> std::optional<platform::InputEvent>;
+  //! Drain the SDL event queue, dispatching the non-input events and queuing
+  //! the input events. Stops when `events_` is full, leaving the rest in the
+  //! SDL queue for the polls after the next `NewFrame()`.
+  void PumpEvents();
+
+  // Large enough for the bursts of a frame, mouse motion included.
+  static constexpr size_t kEventQueueCapacity{1024};
+  platform::EventQueue<SDL_Event> events_{kEventQueueCapacity};
+  // Whether events were drained with `PollEvents()` since the last frame
+  // boundary, their raw events must then stay valid until `NewFrame()`.
+  bool batch_polled_{false};
 
   std::shared_ptr<detail::WrapperInterface> sdl_;
+  // User event pushed by `Wake()` to end `WaitForEvents()`, never dispatched.
+  uint32_t wake_event_type_{0};
   std::vector<std::shared_ptr<Window>> windows_;
 
   sigslot::signal<const SDL_Event &> on_unhandled_event_;
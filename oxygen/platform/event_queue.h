@@ -0,0 +1,142 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "oxygen/platform/input_event.h"
+
+namespace oxygen::platform {
+
+/*!
+ Fixed-capacity ring buffer of translated input events, each stored with a copy
+ of the raw platform event it was translated from.
+
+ Every event keeps its storage slot, and the raw event returned by its
+ `GetRawEvent()` stays valid, from the moment it is pushed until `Release()` is
+ called after it was popped. Platforms call `Release()` at the frame boundary,
+ so that the events polled during a frame can be buffered and examined later
+ within that frame.
+
+ When all the slots are taken, new events are dropped and counted, nothing is
+ ever allocated after construction. Platforms fill the queue with `Pump()`,
+ which leaves the events it has no room for in the platform's own queue
+ instead.
+
+ Not thread safe, the queue is filled and drained by the thread running the
+ event loop.
+*/
+template <typename RawEvent> class EventQueue {
+public:
+  explicit EventQueue(const size_t capacity) : slots_(capacity) {
+    assert(capacity > 0);
+  }
+
+  //! Add `event` at the back of the queue, with a copy of `raw_event` that
+  //! becomes its raw event.
+  //! \return `false` if the queue is full and the event was dropped.
+  auto Push(InputEvent event, const RawEvent &raw_event) -> bool {
+    if (IsFull()) {
+      ++dropped_;
+      return false;
+    }
+    auto &slot = slots_[write_ % slots_.size()];
+    slot.raw_event = raw_event;
+    event.SetRawEvent(&slot.raw_event);
+    slot.event = event;
+    ++write_;
+    return true;
+  }
+
+  /*!
+   Move the raw events produced by `poll` to the queue, translated by
+   `translate`, until `poll` has no more events or the queue is full. Raw
+   events without a translation are consumed without taking a slot.
+
+   Polling stops before an event is consumed that could not be stored, the
+   remaining ones stay with the platform until slots are released, so none is
+   dropped, key releases included.
+
+   \param poll called as `poll(RawEvent &)`, returns `false` when it has no
+   more events.
+   \param translate called as `translate(const RawEvent &)`, returns an
+   `std::optional<InputEvent>`.
+   \return `false` if polling stopped because the queue is full.
+  */
+  template <typename Poll, typename Translate>
+  auto Pump(Poll &&poll, Translate &&translate) -> bool {
+    RawEvent raw_event{};
+    while (!IsFull()) {
+      if (!poll(raw_event)) {
+        return true;
+      }
+      if (const std::optional<InputEvent> event = translate(raw_event)) {
+        Push(*event, raw_event);
+      }
+    }
+    return false;
+  }
+
+  //! Copy the oldest events to `events`, in the order they were pushed, and
+  //! remove them from the queue. Their slots stay reserved until `Release()`.
+  //! \return the number of events copied.
+  auto Pop(std::span<InputEvent> events) -> size_t {
+    const auto count = std::min(events.size(), Size());
+    for (size_t index = 0; index < count; ++index) {
+      events[index] = slots_[read_ % slots_.size()].event;
+      ++read_;
+    }
+    return count;
+  }
+
+  //! Free the slots of the popped events, invalidating their raw events.
+  void Release() {
+    release_ = read_;
+  }
+
+  //! Number of events pushed and not yet popped.
+  [[nodiscard]] auto Size() const -> size_t {
+    return write_ - read_;
+  }
+
+  [[nodiscard]] auto Capacity() const -> size_t {
+    return slots_.size();
+  }
+
+  //! `true` when all the slots are taken, by queued events or by popped events
+  //! that were not released yet.
+  [[nodiscard]] auto IsFull() const -> bool {
+    return write_ - release_ == slots_.size();
+  }
+
+  //! Number of events dropped because the queue was full, since it was
+  //! created.
+  [[nodiscard]] auto DroppedCount() const -> size_t {
+    return dropped_;
+  }
+
+private:
+  struct Slot {
+    InputEvent event;
+    RawEvent raw_event{};
+  };
+
+  std::vector<Slot> slots_;
+  // Monotonic counters, the slot index is the counter modulo the capacity.
+  // Released <= read <= write.
+  size_t release_{0};
+  size_t read_{0};
+  size_t write_{0};
+  size_t dropped_{0};
+};
+
+} // namespace oxygen::platform
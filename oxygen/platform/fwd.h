@@ -16,6 +16,7 @@ namespace platform {
 class Display;
 class Window;
 class InputEvent;
+class InputRecorder;
 class KeyEvent;
 class MouseButtonEvent;
 class MouseWheelEvent;
@@ -6,35 +6,38 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
-#include <map>
-#include <memory>
+#include <string_view>
 #include <vector>
 
 #include "oxygen/platform/types.h"
 
-//------------------------------------------------------------------------------
-// InputSlotDetails
-//------------------------------------------------------------------------------
-
-namespace oxygen::platform::detail {
-class InputSlotDetails;
-} // namespace oxygen::platform::detail
-
 //------------------------------------------------------------------------------
 // InputSlot
 //------------------------------------------------------------------------------
 
 namespace oxygen::platform {
+/*!
+ Identifies a source of input (a key, a mouse button, a mouse axis...).
+
+ All slots are defined at compile time in `InputSlots`, each with a dense
+ integer id, which is all that is compared, hashed and used to look up the
+ slot details.
+*/
 class InputSlot {
 public:
-  explicit InputSlot(const std::string_view name) : name_(name) {
-  }
+  using IdType = uint16_t;
 
-  [[nodiscard]] auto GetName() const {
+  [[nodiscard]] constexpr auto GetName() const {
     return name_;
   }
 
+  //! Index of the slot, from `0` to `InputSlots::kSlotCount - 1`.
+  [[nodiscard]] constexpr auto GetId() const {
+    return id_;
+  }
+
   auto IsModifierKey() const -> bool;
   auto IsKeyboardKey() const -> bool;
   auto IsMouseButton() const -> bool;
@@ -49,28 +52,33 @@ public:
 
   [[nodiscard]] auto GetInputCategoryName() const -> std::string_view;
 
-  friend auto operator==(const InputSlot &lhs, const InputSlot &rhs) -> bool {
-    return lhs.name_ == rhs.name_;
+  friend constexpr auto operator==(
+      const InputSlot &lhs, const InputSlot &rhs) -> bool {
+    return lhs.id_ == rhs.id_;
   }
-  friend auto operator!=(const InputSlot &lhs, const InputSlot &rhs) -> bool {
-    return lhs.name_ != rhs.name_;
+  friend constexpr auto operator!=(
+      const InputSlot &lhs, const InputSlot &rhs) -> bool {
+    return lhs.id_ != rhs.id_;
   }
-  friend auto operator<(const InputSlot &lhs, const InputSlot &rhs) -> bool {
-    return lhs.name_ < rhs.name_;
+  friend constexpr auto operator<(
+      const InputSlot &lhs, const InputSlot &rhs) -> bool {
+    return lhs.id_ < rhs.id_;
   }
 
 private:
-  std::string_view name_;
-  mutable std::shared_ptr<detail::InputSlotDetails> details_;
+  constexpr InputSlot(const std::string_view name, const IdType id)
+      : name_(name), id_(id) {
+  }
 
-  void UpdateDetailsIfNotUpdated() const;
+  std::string_view name_;
+  IdType id_;
 };
 } // namespace oxygen::platform
 
 template <> struct std::hash<oxygen::platform::InputSlot> {
   auto operator()(
       const oxygen::platform::InputSlot &slot) const noexcept -> size_t {
-    return hash<std::string_view>()(slot.GetName());
+    return slot.GetId();
   }
 };
 
@@ -82,191 +90,174 @@ namespace oxygen::platform {
 class InputSlots {
 public:
   // Category names static string_view literals
-  static const std::string_view kKeyCategoryName;
-  static const std::string_view kMouseCategoryName;
+  static constexpr std::string_view kKeyCategoryName{"Key"};
+  static constexpr std::string_view kMouseCategoryName{"Mouse"};
 
   // -- Static input slots
   // NOLINTBEGIN
   // Mouse slots
-  static const InputSlot MouseWheelUp;
-  static const InputSlot MouseWheelDown;
-  static const InputSlot MouseWheelLeft;
-  static const InputSlot MouseWheelRight;
-  static const InputSlot MouseWheelX;
-  static const InputSlot MouseWheelY;
-  static const InputSlot MouseWheelXY;
-  static const InputSlot LeftMouseButton;
-  static const InputSlot RightMouseButton;
-  static const InputSlot MiddleMouseButton;
-  static const InputSlot ThumbMouseButton1;
-  static const InputSlot ThumbMouseButton2;
-  static const InputSlot MouseX;
-  static const InputSlot MouseY;
-  static const InputSlot MouseXY;
+  static constexpr InputSlot MouseWheelUp{"MouseWheelUp", 0};
+  static constexpr InputSlot MouseWheelDown{"MouseWheelDown", 1};
+  static constexpr InputSlot MouseWheelLeft{"MouseWheelLeft", 2};
+  static constexpr InputSlot MouseWheelRight{"MouseWheelRight", 3};
+  static constexpr InputSlot MouseWheelX{"MouseWheelX", 4};
+  static constexpr InputSlot MouseWheelY{"MouseWheelY", 5};
+  static constexpr InputSlot MouseWheelXY{"MouseWheelXY", 6};
+  static constexpr InputSlot LeftMouseButton{"LeftMouseButton", 7};
+  static constexpr InputSlot RightMouseButton{"RightMouseButton", 8};
+  static constexpr InputSlot MiddleMouseButton{"MiddleMouseButton", 9};
+  static constexpr InputSlot ThumbMouseButton1{"ThumbMouseButton1", 10};
+  static constexpr InputSlot ThumbMouseButton2{"ThumbMouseButton2", 11};
+  static constexpr InputSlot MouseX{"MouseX", 12};
+  static constexpr InputSlot MouseY{"MouseY", 13};
+  static constexpr InputSlot MouseXY{"MouseXY", 14};
 
   // Keyboard slots
-  static const InputSlot None;
-  static const InputSlot AnyKey;
-  static const InputSlot BackSpace;
-  static const InputSlot Delete;
-  static const InputSlot Tab;
-  static const InputSlot Clear;
-  static const InputSlot Return;
-  static const InputSlot Pause;
-  static const InputSlot Escape;
-  static const InputSlot Space;
-  static const InputSlot Keypad0;
-  static const InputSlot Keypad1;
-  static const InputSlot Keypad2;
-  static const InputSlot Keypad3;
-  static const InputSlot Keypad4;
-  static const InputSlot Keypad5;
-  static const InputSlot Keypad6;
-  static const InputSlot Keypad7;
-  static const InputSlot Keypad8;
-  static const InputSlot Keypad9;
-  static const InputSlot KeypadPeriod;
-  static const InputSlot KeypadDivide;
-  static const InputSlot KeypadMultiply;
-  static const InputSlot KeypadMinus;
-  static const InputSlot KeypadPlus;
-  static const InputSlot KeypadEnter;
-  static const InputSlot KeypadEquals;
-  static const InputSlot UpArrow;
-  static const InputSlot DownArrow;
-  static const InputSlot RightArrow;
-  static const InputSlot LeftArrow;
-  static const InputSlot Insert;
-  static const InputSlot Home;
-  static const InputSlot End;
-  static const InputSlot PageUp;
-  static const InputSlot PageDown;
-  static const InputSlot F1;
-  static const InputSlot F2;
-  static const InputSlot F3;
-  static const InputSlot F4;
-  static const InputSlot F5;
-  static const InputSlot F6;
-  static const InputSlot F7;
-  static const InputSlot F8;
-  static const InputSlot F9;
-  static const InputSlot F10;
-  static const InputSlot F11;
-  static const InputSlot F12;
-  static const InputSlot F13;
-  static const InputSlot F14;
-  static const InputSlot F15;
-  static const InputSlot Alpha0;
-  static const InputSlot Alpha1;
-  static const InputSlot Alpha2;
-  static const InputSlot Alpha3;
-  static const InputSlot Alpha4;
-  static const InputSlot Alpha5;
-  static const InputSlot Alpha6;
-  static const InputSlot Alpha7;
-  static const InputSlot Alpha8;
-  static const InputSlot Alpha9;
-  static const InputSlot Exclaim;
-  static const InputSlot DoubleQuote;
-  static const InputSlot Hash;
-  static const InputSlot Dollar;
-  static const InputSlot Percent;
-  static const InputSlot Ampersand;
-  static const InputSlot Quote;
-  static const InputSlot LeftParen;
-  static const InputSlot RightParen;
-  static const InputSlot Asterisk;
-  static const InputSlot Plus;
-  static const InputSlot Comma;
-  static const InputSlot Minus;
-  static const InputSlot Period;
-  static const InputSlot Slash;
-  static const InputSlot Colon;
-  static const InputSlot Semicolon;
-  static const InputSlot Less;
-  static const InputSlot Equals;
-  static const InputSlot Greater;
-  static const InputSlot Question;
-  static const InputSlot At;
-  static const InputSlot LeftBracket;
-  static const InputSlot Backslash;
-  static const InputSlot RightBracket;
-  static const InputSlot Caret;
-  static const InputSlot Underscore;
-  static const InputSlot BackQuote;
-  static const InputSlot A;
-  static const InputSlot B;
-  static const InputSlot C;
-  static const InputSlot D;
-  static const InputSlot E;
-  static const InputSlot F;
-  static const InputSlot G;
-  static const InputSlot H;
-  static const InputSlot I;
-  static const InputSlot J;
-  static const InputSlot K;
-  static const InputSlot L;
-  static const InputSlot M;
-  static const InputSlot N;
-  static const InputSlot O;
-  static const InputSlot P;
-  static const InputSlot Q;
-  static const InputSlot R;
-  static const InputSlot S;
-  static const InputSlot T;
-  static const InputSlot U;
-  static const InputSlot V;
-  static const InputSlot W;
-  static const InputSlot X;
-  static const InputSlot Y;
-  static const InputSlot Z;
-  static const InputSlot NumLock;
-  static const InputSlot CapsLock;
-  static const InputSlot ScrollLock;
-  static const InputSlot RightShift;
-  static const InputSlot LeftShift;
-  static const InputSlot RightControl;
-  static const InputSlot LeftControl;
-  static const InputSlot RightAlt;
-  static const InputSlot LeftAlt;
-  static const InputSlot LeftMeta;
-  static const InputSlot RightMeta;
-  static const InputSlot Help;
-  static const InputSlot Print;
-  static const InputSlot SysReq;
-  static const InputSlot Menu;
-  // Mouse buttons
+  static constexpr InputSlot None{"None", 15};
+  static constexpr InputSlot AnyKey{"AnyKey", 16};
+  static constexpr InputSlot BackSpace{"BackSpace", 17};
+  static constexpr InputSlot Delete{"Delete", 18};
+  static constexpr InputSlot Tab{"Tab", 19};
+  static constexpr InputSlot Clear{"Clear", 20};
+  static constexpr InputSlot Return{"Return", 21};
+  static constexpr InputSlot Pause{"Pause", 22};
+  static constexpr InputSlot Escape{"Escape", 23};
+  static constexpr InputSlot Space{"Space", 24};
+  static constexpr InputSlot Keypad0{"Keypad0", 25};
+  static constexpr InputSlot Keypad1{"Keypad1", 26};
+  static constexpr InputSlot Keypad2{"Keypad2", 27};
+  static constexpr InputSlot Keypad3{"Keypad3", 28};
+  static constexpr InputSlot Keypad4{"Keypad4", 29};
+  static constexpr InputSlot Keypad5{"Keypad5", 30};
+  static constexpr InputSlot Keypad6{"Keypad6", 31};
+  static constexpr InputSlot Keypad7{"Keypad7", 32};
+  static constexpr InputSlot Keypad8{"Keypad8", 33};
+  static constexpr InputSlot Keypad9{"Keypad9", 34};
+  static constexpr InputSlot KeypadPeriod{"KeypadPeriod", 35};
+  static constexpr InputSlot KeypadDivide{"KeypadDivide", 36};
+  static constexpr InputSlot KeypadMultiply{"KeypadMultiply", 37};
+  static constexpr InputSlot KeypadMinus{"KeypadMinus", 38};
+  static constexpr InputSlot KeypadPlus{"KeypadPlus", 39};
+  static constexpr InputSlot KeypadEnter{"KeypadEnter", 40};
+  static constexpr InputSlot KeypadEquals{"KeypadEquals", 41};
+  static constexpr InputSlot UpArrow{"Up", 42};
+  static constexpr InputSlot DownArrow{"Down", 43};
+  static constexpr InputSlot RightArrow{"Right", 44};
+  static constexpr InputSlot LeftArrow{"Left", 45};
+  static constexpr InputSlot Insert{"Insert", 46};
+  static constexpr InputSlot Home{"Home", 47};
+  static constexpr InputSlot End{"End", 48};
+  static constexpr InputSlot PageUp{"PageUp", 49};
+  static constexpr InputSlot PageDown{"PageDown", 50};
+  static constexpr InputSlot F1{"F1", 51};
+  static constexpr InputSlot F2{"F2", 52};
+  static constexpr InputSlot F3{"F3", 53};
+  static constexpr InputSlot F4{"F4", 54};
+  static constexpr InputSlot F5{"F5", 55};
+  static constexpr InputSlot F6{"F6", 56};
+  static constexpr InputSlot F7{"F7", 57};
+  static constexpr InputSlot F8{"F8", 58};
+  static constexpr InputSlot F9{"F9", 59};
+  static constexpr InputSlot F10{"F10", 60};
+  static constexpr InputSlot F11{"F11", 61};
+  static constexpr InputSlot F12{"F12", 62};
+  static constexpr InputSlot F13{"F13", 63};
+  static constexpr InputSlot F14{"F14", 64};
+  static constexpr InputSlot F15{"F15", 65};
+  static constexpr InputSlot Alpha0{"0", 66};
+  static constexpr InputSlot Alpha1{"1", 67};
+  static constexpr InputSlot Alpha2{"2", 68};
+  static constexpr InputSlot Alpha3{"3", 69};
+  static constexpr InputSlot Alpha4{"4", 70};
+  static constexpr InputSlot Alpha5{"5", 71};
+  static constexpr InputSlot Alpha6{"6", 72};
+  static constexpr InputSlot Alpha7{"7", 73};
+  static constexpr InputSlot Alpha8{"8", 74};
+  static constexpr InputSlot Alpha9{"9", 75};
+  static constexpr InputSlot Exclaim{"!", 76};
+  static constexpr InputSlot DoubleQuote{"DoubleQuote", 77};
+  static constexpr InputSlot Hash{"Hash", 78};
+  static constexpr InputSlot Dollar{"Dollar", 79};
+  static constexpr InputSlot Percent{"Percent", 80};
+  static constexpr InputSlot Ampersand{"Ampersand", 81};
+  static constexpr InputSlot Quote{"Quote", 82};
+  static constexpr InputSlot LeftParen{"LeftParen", 83};
+  static constexpr InputSlot RightParen{"RightParen", 84};
+  static constexpr InputSlot Asterisk{"Asterisk", 85};
+  static constexpr InputSlot Plus{"Plus", 86};
+  static constexpr InputSlot Comma{"Comma", 87};
+  static constexpr InputSlot Minus{"Minus", 88};
+  static constexpr InputSlot Period{"Period", 89};
+  static constexpr InputSlot Slash{"Slash", 90};
+  static constexpr InputSlot Colon{"Colon", 91};
+  static constexpr InputSlot Semicolon{"Semicolon", 92};
+  static constexpr InputSlot Less{"Less", 93};
+  static constexpr InputSlot Equals{"Equals", 94};
+  static constexpr InputSlot Greater{"Greater", 95};
+  static constexpr InputSlot Question{"Question", 96};
+  static constexpr InputSlot At{"At", 97};
+  static constexpr InputSlot LeftBracket{"LeftBracket", 98};
+  static constexpr InputSlot Backslash{"Backslash", 99};
+  static constexpr InputSlot RightBracket{"RightBracket", 100};
+  static constexpr InputSlot Caret{"Caret", 101};
+  static constexpr InputSlot Underscore{"Underscore", 102};
+  static constexpr InputSlot BackQuote{"BackQuote", 103};
+  static constexpr InputSlot A{"A", 104};
+  static constexpr InputSlot B{"B", 105};
+  static constexpr InputSlot C{"C", 106};
+  static constexpr InputSlot D{"D", 107};
+  static constexpr InputSlot E{"E", 108};
+  static constexpr InputSlot F{"F", 109};
+  static constexpr InputSlot G{"G", 110};
+  static constexpr InputSlot H{"H", 111};
+  static constexpr InputSlot I{"I", 112};
+  static constexpr InputSlot J{"J", 113};
+  static constexpr InputSlot K{"K", 114};
+  static constexpr InputSlot L{"L", 115};
+  static constexpr InputSlot M{"M", 116};
+  static constexpr InputSlot N{"N", 117};
+  static constexpr InputSlot O{"O", 118};
+  static constexpr InputSlot P{"P", 119};
+  static constexpr InputSlot Q{"Q", 120};
+  static constexpr InputSlot R{"R", 121};
+  static constexpr InputSlot S{"S", 122};
+  static constexpr InputSlot T{"T", 123};
+  static constexpr InputSlot U{"U", 124};
+  static constexpr InputSlot V{"V", 125};
+  static constexpr InputSlot W{"W", 126};
+  static constexpr InputSlot X{"X", 127};
+  static constexpr InputSlot Y{"Y", 128};
+  static constexpr InputSlot Z{"Z", 129};
+  static constexpr InputSlot NumLock{"NumLock", 130};
+  static constexpr InputSlot CapsLock{"CapsLock", 131};
+  static constexpr InputSlot ScrollLock{"ScrollLock", 132};
+  static constexpr InputSlot RightShift{"RightShift", 133};
+  static constexpr InputSlot LeftShift{"LeftShift", 134};
+  static constexpr InputSlot RightControl{"RightCtrl", 135};
+  static constexpr InputSlot LeftControl{"LeftCtrl", 136};
+  static constexpr InputSlot RightAlt{"RightAlt", 137};
+  static constexpr InputSlot LeftAlt{"LeftAlt", 138};
+  static constexpr InputSlot LeftMeta{"LeftMeta", 139};
+  static constexpr InputSlot RightMeta{"RightMeta", 140};
+  static constexpr InputSlot Help{"Help", 141};
+  static constexpr InputSlot Print{"PrintScreen", 142};
+  static constexpr InputSlot SysReq{"SysReq", 143};
+  static constexpr InputSlot Menu{"Menu", 144};
   // NOLINTEND
 
+  static constexpr InputSlot::IdType kSlotCount{145};
+
   friend class oxygen::Platform;
-  friend class InputSlot;
 
-  // TODO: review visibility and keep safe methods public
-  // private:
+  //! Kept for compatibility, the slots are all defined at compile time and
+  //! need no initialization.
   static void Initialize();
 
   static void GetAllInputSlots(std::vector<InputSlot> &out_keys);
-  static auto GetInputSlotForKey(Key key) -> InputSlot;
+  static auto GetInputSlotForKey(Key key) -> const InputSlot &;
 
   static auto GetCategoryDisplayName(
       std::string_view category_name) -> std::string_view;
-
-  struct CategoryInfo {
-    std::string_view display_string;
-  };
-
-  static std::map<InputSlot, std::shared_ptr<detail::InputSlotDetails>> slots_;
-  static std::map<Key, InputSlot> key_slots_;
-  static std::map<std::string_view, CategoryInfo> categories_;
-
-  // TODO(abdes) add user defined slots and categories
-  static void AddCategory(
-      std::string_view category_name, std::string_view display_string);
-  static void AddInputSlot(const detail::InputSlotDetails &detail);
-  static void AddKeyInputSlot(
-      Key key_code, const detail::InputSlotDetails &detail);
-  [[nodiscard]] static auto GetInputSlotDetails(
-      const InputSlot &slot) -> std::shared_ptr<detail::InputSlotDetails>;
 };
 
 } // namespace oxygen::platform
@@ -0,0 +1,115 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "oxygen/platform/input_coalescing.h"
+
+#include <algorithm>
+#include <array>
+#include <span>
+
+using oxygen::platform::InputEvent;
+using oxygen::platform::InputEventType;
+using oxygen::platform::MouseMotionEvent;
+using oxygen::platform::MouseWheelEvent;
+using oxygen::platform::WindowIdType;
+
+namespace {
+
+// The event receiving the events of the same type and window, until another
+// kind of event of the window ends the run.
+struct Aggregate {
+  WindowIdType window_id;
+  InputEventType type;
+  size_t index;
+};
+
+// Windows are few, the aggregates are looked up linearly.
+constexpr size_t kMaxWindows{16};
+
+template <typename Payload>
+void SetPayload(InputEvent &event, const Payload &payload) {
+  const auto window_id = event.GetWindowId();
+  event = InputEvent(event.GetRawEvent(), event.GetTime(), payload);
+  event.SetWindowId(window_id);
+}
+
+// Add the motion or scroll amount of `earlier` to `latest`.
+void Merge(InputEvent &latest, const InputEvent &earlier) {
+  if (latest.GetType() == InputEventType::kMouseMotionEvent) {
+    const auto &motion = latest.As<MouseMotionEvent>();
+    const auto &earlier_motion = earlier.As<MouseMotionEvent>();
+    SetPayload(latest, MouseMotionEvent(motion.GetPosition(),
+                           {
+                               .dx = motion.GetMotion().dx +
+                                     earlier_motion.GetMotion().dx,
+                               .dy = motion.GetMotion().dy +
+                                     earlier_motion.GetMotion().dy,
+                           }));
+  } else {
+    const auto &wheel = latest.As<MouseWheelEvent>();
+    const auto &earlier_wheel = earlier.As<MouseWheelEvent>();
+    SetPayload(latest, MouseWheelEvent(wheel.GetPosition(),
+                           {
+                               .dx = wheel.GetScrollAmount().dx +
+                                     earlier_wheel.GetScrollAmount().dx,
+                               .dy = wheel.GetScrollAmount().dy +
+                                     earlier_wheel.GetScrollAmount().dy,
+                           }));
+  }
+}
+
+} // namespace
+
+auto oxygen::platform::CoalesceMouseEvents(std::vector<InputEvent> &events)
+    -> size_t {
+  // One for the motion and one for the wheel of each window.
+  std::array<Aggregate, 2 * kMaxWindows> aggregates{};
+  size_t aggregate_count{0};
+
+  // Walk the events backwards, so that the last event of each run receives
+  // the ones before it, while moving the kept events towards the back.
+  auto kept = events.size();
+  for (auto index = events.size(); index-- > 0;) {
+    const auto event = events[index];
+    const auto type = event.GetType();
+    if (type != InputEventType::kMouseMotionEvent &&
+        type != InputEventType::kMouseWheelEvent) {
+      // The runs of the window end here, the events before cannot be moved
+      // after this one.
+      const auto ended = std::ranges::remove_if(
+          std::span(aggregates).first(aggregate_count),
+          [&event](const Aggregate &aggregate) {
+            return event.IsFromWindow(aggregate.window_id);
+          });
+      aggregate_count -= ended.size();
+      events[--kept] = event;
+      continue;
+    }
+    const auto candidates = std::span(aggregates).first(aggregate_count);
+    const auto aggregate = std::ranges::find_if(
+        candidates, [&event, type](const Aggregate &candidate) {
+          return candidate.type == type &&
+                 event.IsFromWindow(candidate.window_id);
+        });
+    if (aggregate != candidates.end()) {
+      Merge(events[aggregate->index], event);
+      continue;
+    }
+    if (aggregate_count < aggregates.size()) {
+      aggregates[aggregate_count++] = {
+          .window_id = event.GetWindowId(),
+          .type = type,
+          .index = kept - 1,
+      };
+    }
+    events[--kept] = event;
+  }
+
+  const auto removed = kept;
+  events.erase(events.begin(),
+      events.begin() + static_cast<std::ptrdiff_t>(removed));
+  return removed;
+}
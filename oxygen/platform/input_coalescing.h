@@ -0,0 +1,37 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "oxygen/platform/input_event.h"
+
+namespace oxygen::platform {
+
+/*!
+ Merge, in place, each run of mouse motion events of a window into a single
+ event, and do the same for the mouse wheel events.
+
+ A high polling rate mouse produces dozens of samples per frame, of which
+ consumers that sample the input once per frame only need the total. The merged
+ event replaces the last of the events it merges, with its position, time
+ stamp and raw event, and with the sum of their motions or scroll amounts.
+
+ A run ends at any other event of the same window, such as a click or a key
+ press, so that no motion or scroll is moved across it: a click still happens
+ at the position the mouse had when it was pressed. Motion and wheel events do
+ not end each other's runs. The other events are left untouched, in their
+ order.
+
+ Nothing is allocated, the runs of at most 16 windows at a time are merged.
+
+ \return the number of events removed.
+*/
+auto CoalesceMouseEvents(std::vector<InputEvent> &events) -> size_t;
+
+} // namespace oxygen::platform
@@ -6,7 +6,10 @@
 
 #pragma once
 
+#include <cassert>
 #include <chrono>
+#include <cstddef>
+#include <type_traits>
 
 #include "oxygen/base/types.h"
 #include "oxygen/platform/types.h"
@@ -19,84 +22,23 @@ enum class InputEventType : uint8_t {
   kMouseMotionEvent,
   kMouseWheelEvent,
 };
+[[maybe_unused]] constexpr size_t kInputEventTypeCount =
+    static_cast<size_t>(InputEventType::kMouseWheelEvent) + 1;
 
-class InputEvent {
+//! A keyboard key was pressed or released.
+class KeyEvent {
 public:
-  // TODO(abdes) temporarily pass the raw event fro ImGui
-  // Should implement an adapter for ImGui
-  explicit InputEvent(const void *raw_event, const TimePoint &time)
-      : time_(time), raw_event_(raw_event) {
-  }
-  virtual ~InputEvent() = default;
-
-  InputEvent(const InputEvent &) = default;
-  auto operator=(const InputEvent &) -> InputEvent & = default;
-
-  InputEvent(InputEvent &&other) noexcept = default;
-  auto operator=(InputEvent &&other) noexcept -> InputEvent & = default;
-
-  [[nodiscard]] virtual auto GetType() const -> InputEventType = 0;
-
-  [[nodiscard]] auto GetWindowId() const {
-    return window_id_;
-  }
-  auto SetWindowId(const WindowIdType window_id) {
-    window_id_ = window_id;
-  }
-
-  [[nodiscard]] auto GetTime() const {
-    return time_;
-  }
-
-  [[nodiscard]] auto IsFromWindow(const WindowIdType window_id) const {
-    return window_id_ == window_id;
-  }
-
-  [[nodiscard]] auto GetRawEvent() const -> const void * {
-    return raw_event_;
-  }
-
-private:
-  WindowIdType window_id_{platform::kInvalidWindowId};
-  TimePoint time_; // time at which the event occurred
-                   // relative to the core starting time.
-  const void *raw_event_;
-};
+  static constexpr auto kType = InputEventType::kKeyEvent;
 
-class ButtonInputEvent : public virtual InputEvent {
-public:
-  ~ButtonInputEvent() override = default;
-
-  ButtonInputEvent(const ButtonInputEvent &) = default;
-  auto operator=(const ButtonInputEvent &) -> ButtonInputEvent & = default;
-
-  ButtonInputEvent(ButtonInputEvent &&other) noexcept = default;
-  auto operator=(
-      ButtonInputEvent &&other) noexcept -> ButtonInputEvent & = default;
-
-  [[nodiscard]] auto GetButtonState() const {
-    return state_;
-  }
-
-protected:
-  explicit ButtonInputEvent(const ButtonState &state) : state_(state) {
-  }
-
-private:
-  ButtonState state_;
-};
-
-class KeyEvent : public ButtonInputEvent {
-public:
   struct KeyInfo {
-    explicit KeyInfo(const Key key_code, const bool repeat = false)
+    explicit constexpr KeyInfo(const Key key_code, const bool repeat = false)
         : key_code_(key_code), repeat_(repeat) {
     }
 
-    [[nodiscard]] auto GetKeyCode() const {
+    [[nodiscard]] constexpr auto GetKeyCode() const {
       return key_code_;
     }
-    [[nodiscard]] auto IsRepeat() const {
+    [[nodiscard]] constexpr auto IsRepeat() const {
       return repeat_;
     }
 
@@ -105,143 +47,193 @@ public:
     bool repeat_;
   };
 
-  KeyEvent(const void *raw_event, const TimePoint &time, const KeyInfo &key,
-      const ButtonState &state)
-      : InputEvent(raw_event, time), ButtonInputEvent(state), key_(key) {
+  constexpr KeyEvent(const KeyInfo &key, const ButtonState state)
+      : key_(key), state_(state) {
   }
 
-  ~KeyEvent() override = default;
-
-  KeyEvent(const KeyEvent &) = default;
-  auto operator=(const KeyEvent &) -> KeyEvent & = default;
-
-  KeyEvent(KeyEvent &&other) noexcept = default;
-  auto operator=(KeyEvent &&other) noexcept -> KeyEvent & = default;
-
-  [[nodiscard]] auto GetType() const -> InputEventType override {
-    return InputEventType::kKeyEvent;
-  }
-
-  [[nodiscard]] auto GetKeyCode() const {
+  [[nodiscard]] constexpr auto GetKeyCode() const {
     return key_.GetKeyCode();
   }
-  [[nodiscard]] auto IsRepeat() const {
+  [[nodiscard]] constexpr auto IsRepeat() const {
     return key_.IsRepeat();
   }
+  [[nodiscard]] constexpr auto GetButtonState() const {
+    return state_;
+  }
 
 private:
   KeyInfo key_;
+  ButtonState state_;
 };
 
-class MouseEvent : public virtual InputEvent {
+//! A mouse button was pressed or released.
+class MouseButtonEvent {
 public:
-  ~MouseEvent() override = default;
-
-  MouseEvent(const MouseEvent &) = default;
-  auto operator=(const MouseEvent &) -> MouseEvent & = default;
+  static constexpr auto kType = InputEventType::kMouseButtonEvent;
 
-  MouseEvent(MouseEvent &&other) noexcept = default;
-  auto operator=(MouseEvent &&other) noexcept -> MouseEvent & = default;
+  constexpr MouseButtonEvent(const SubPixelPosition &position,
+      const MouseButton button, const ButtonState state)
+      : position_(position), button_(button), state_(state) {
+  }
 
-  [[nodiscard]] auto GetPosition() const {
+  [[nodiscard]] constexpr auto GetPosition() const {
     return position_;
   }
-
-protected:
-  explicit MouseEvent(const SubPixelPosition &position) : position_(position) {
+  [[nodiscard]] constexpr auto GetButton() const {
+    return button_;
+  }
+  [[nodiscard]] constexpr auto GetButtonState() const {
+    return state_;
   }
 
 private:
   SubPixelPosition position_; // relative to window
+  MouseButton button_;
+  ButtonState state_;
 };
 
-class MouseButtonEvent : public MouseEvent, public ButtonInputEvent {
+//! The mouse moved.
+class MouseMotionEvent {
 public:
-  MouseButtonEvent(const void *raw_event, const TimePoint &time,
-      const SubPixelPosition &position, const MouseButton button,
-      const ButtonState &state)
-      : InputEvent(raw_event, time), MouseEvent(position),
-        ButtonInputEvent(state), button_(button) {
-  }
-
-  ~MouseButtonEvent() override = default;
-
-  MouseButtonEvent(const MouseButtonEvent &) = default;
-  auto operator=(const MouseButtonEvent &) -> MouseButtonEvent & = default;
-
-  MouseButtonEvent(MouseButtonEvent &&other) noexcept = default;
-  auto operator=(
-      MouseButtonEvent &&other) noexcept -> MouseButtonEvent & = default;
+  static constexpr auto kType = InputEventType::kMouseMotionEvent;
 
-  [[nodiscard]] auto GetType() const -> InputEventType override {
-    return InputEventType::kMouseButtonEvent;
+  constexpr MouseMotionEvent(
+      const SubPixelPosition &position, const SubPixelMotion &motion)
+      : position_(position), motion_(motion) {
   }
 
-  [[nodiscard]] auto GetButton() const {
-    return button_;
+  [[nodiscard]] constexpr auto GetPosition() const {
+    return position_;
+  }
+  [[nodiscard]] constexpr auto GetMotion() const {
+    return motion_;
   }
 
 private:
-  MouseButton button_;
+  SubPixelPosition position_; // relative to window
+  SubPixelMotion motion_;     // relative motion from last position
 };
 
-class MouseMotionEvent : public MouseEvent {
+//! The mouse wheel was scrolled.
+class MouseWheelEvent {
 public:
-  MouseMotionEvent(const void *raw_event, const TimePoint &time,
-      const SubPixelPosition &position, const SubPixelMotion &motion)
-      : InputEvent(raw_event, time), MouseEvent(position), motion_(motion) {
-  }
-
-  ~MouseMotionEvent() override = default;
-
-  MouseMotionEvent(const MouseMotionEvent &) = default;
-  auto operator=(const MouseMotionEvent &) -> MouseMotionEvent & = default;
+  static constexpr auto kType = InputEventType::kMouseWheelEvent;
 
-  MouseMotionEvent(MouseMotionEvent &&other) noexcept = default;
-  auto operator=(
-      MouseMotionEvent &&other) noexcept -> MouseMotionEvent & = default;
-
-  [[nodiscard]] auto GetType() const -> InputEventType override {
-    return InputEventType::kMouseMotionEvent;
+  constexpr MouseWheelEvent(
+      const SubPixelPosition &position, const SubPixelMotion &scroll_amount)
+      : position_(position), scroll_amount_(scroll_amount) {
   }
 
-  [[nodiscard]] auto GetMotion() const {
-    return motion_;
+  [[nodiscard]] constexpr auto GetPosition() const {
+    return position_;
+  }
+  [[nodiscard]] constexpr auto GetScrollAmount() const {
+    return scroll_amount_;
   }
 
 private:
-  SubPixelMotion motion_; // relative motion from last position
+  SubPixelPosition position_; // relative to window
+  // The amount scrolled, positive horizontally to the right and vertically
+  // away from the user
+  SubPixelMotion scroll_amount_;
 };
 
-class MouseWheelEvent : public MouseEvent {
+/*!
+ An input event, made of the properties common to all events and of the
+ payload specific to its type.
+
+ Events are small values that are trivially copyable: the platform emits them
+ into buffers provided by the caller, and consumers switch on `GetType()` and
+ then get the payload with `As<T>()`, without any allocation or RTTI.
+*/
+class InputEvent {
 public:
-  MouseWheelEvent(const void *raw_event, const TimePoint &time,
-      const SubPixelPosition &position, const SubPixelMotion &scroll_amount)
-      : InputEvent(raw_event, time), MouseEvent(position),
-        scroll_amount_(scroll_amount) {
+  //! A placeholder event, for buffers to be filled by the platform.
+  constexpr InputEvent()
+      : InputEvent(nullptr, TimePoint{},
+            KeyEvent(KeyEvent::KeyInfo(Key::kNone), ButtonState::kReleased)) {
   }
 
-  ~MouseWheelEvent() override = default;
+  // TODO(abdes) temporarily pass the raw event fro ImGui
+  // Should implement an adapter for ImGui
+  constexpr InputEvent(
+      const void *raw_event, const TimePoint &time, const KeyEvent &event)
+      : time_(time), raw_event_(raw_event), type_(KeyEvent::kType),
+        key_(event) {
+  }
+  constexpr InputEvent(const void *raw_event, const TimePoint &time,
+      const MouseButtonEvent &event)
+      : time_(time), raw_event_(raw_event), type_(MouseButtonEvent::kType),
+        mouse_button_(event) {
+  }
+  constexpr InputEvent(const void *raw_event, const TimePoint &time,
+      const MouseMotionEvent &event)
+      : time_(time), raw_event_(raw_event), type_(MouseMotionEvent::kType),
+        mouse_motion_(event) {
+  }
+  constexpr InputEvent(const void *raw_event, const TimePoint &time,
+      const MouseWheelEvent &event)
+      : time_(time), raw_event_(raw_event), type_(MouseWheelEvent::kType),
+        mouse_wheel_(event) {
+  }
+
+  [[nodiscard]] constexpr auto GetType() const -> InputEventType {
+    return type_;
+  }
+
+  //! The payload of the event, `T` must match the event type.
+  template <typename T> [[nodiscard]] constexpr auto As() const -> const T & {
+    assert(type_ == T::kType);
+    if constexpr (std::is_same_v<T, KeyEvent>) {
+      return key_;
+    } else if constexpr (std::is_same_v<T, MouseButtonEvent>) {
+      return mouse_button_;
+    } else if constexpr (std::is_same_v<T, MouseMotionEvent>) {
+      return mouse_motion_;
+    } else {
+      static_assert(std::is_same_v<T, MouseWheelEvent>);
+      return mouse_wheel_;
+    }
+  }
 
-  MouseWheelEvent(const MouseWheelEvent &) = default;
-  auto operator=(const MouseWheelEvent &) -> MouseWheelEvent & = default;
+  [[nodiscard]] constexpr auto GetWindowId() const {
+    return window_id_;
+  }
+  constexpr auto SetWindowId(const WindowIdType window_id) {
+    window_id_ = window_id;
+  }
 
-  MouseWheelEvent(MouseWheelEvent &&other) noexcept = default;
-  auto operator=(
-      MouseWheelEvent &&other) noexcept -> MouseWheelEvent & = default;
+  [[nodiscard]] constexpr auto GetTime() const {
+    return time_;
+  }
 
-  [[nodiscard]] auto GetType() const -> InputEventType override {
-    return InputEventType::kMouseWheelEvent;
+  [[nodiscard]] constexpr auto IsFromWindow(
+      const WindowIdType window_id) const {
+    return window_id_ == window_id;
   }
 
-  [[nodiscard]] auto GetScrollAmount() const {
-    return scroll_amount_;
+  [[nodiscard]] constexpr auto GetRawEvent() const -> const void * {
+    return raw_event_;
+  }
+  constexpr auto SetRawEvent(const void *raw_event) {
+    raw_event_ = raw_event;
   }
 
 private:
-  // The amount scrolled, positive horizontally to the right and vertically
-  // away from the user
-  SubPixelMotion scroll_amount_;
+  TimePoint time_; // time at which the event occurred
+                   // relative to the core starting time.
+  const void *raw_event_;
+  WindowIdType window_id_{platform::kInvalidWindowId};
+  InputEventType type_;
+  union {
+    KeyEvent key_;
+    MouseButtonEvent mouse_button_;
+    MouseMotionEvent mouse_motion_;
+    MouseWheelEvent mouse_wheel_;
+  };
 };
 
+static_assert(std::is_trivially_copyable_v<InputEvent>);
+static_assert(sizeof(InputEvent) <= 48);
+
 } // namespace oxygen::platform
@@ -0,0 +1,237 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "oxygen/platform/input_recording.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+using oxygen::Duration;
+using oxygen::TimePoint;
+using oxygen::platform::ButtonState;
+using oxygen::platform::InputEvent;
+using oxygen::platform::InputEventType;
+using oxygen::platform::InputRecorder;
+using oxygen::platform::InputRecording;
+using oxygen::platform::Key;
+using oxygen::platform::KeyEvent;
+using oxygen::platform::MouseButton;
+using oxygen::platform::MouseButtonEvent;
+using oxygen::platform::MouseMotionEvent;
+using oxygen::platform::MouseWheelEvent;
+using oxygen::platform::RecordedInputEvent;
+
+namespace {
+
+// Log layout: the magic and the format version, followed by the frames until
+// the end of the stream. Each frame is its duration in microseconds and its
+// number of events, followed by the events. Each event is its time stamp
+// delta, its window, its type and its payload. Integers are little endian
+// base-128 varints, time deltas are zigzag encoded as they can be negative,
+// floats are little endian IEEE 754.
+constexpr std::array<char, 4> kMagic{'O', 'X', 'I', 'R'};
+constexpr uint8_t kVersion{2};
+
+constexpr uint8_t kRepeatBit{1U << 0U};
+constexpr uint8_t kPressedBit{1U << 1U};
+
+void WriteByte(std::ostream &out, const uint8_t value) {
+  out.put(static_cast<char>(value));
+}
+
+void WriteVarint(std::ostream &out, uint64_t value) {
+  while (value >= 0x80U) {
+    WriteByte(out, static_cast<uint8_t>(value | 0x80U));
+    value >>= 7U;
+  }
+  WriteByte(out, static_cast<uint8_t>(value));
+}
+
+void WriteSigned(std::ostream &out, const int64_t value) {
+  const auto bits = static_cast<uint64_t>(value);
+  WriteVarint(out, (bits << 1U) ^ static_cast<uint64_t>(value >> 63));
+}
+
+void WriteFloat(std::ostream &out, const float value) {
+  auto bits = std::bit_cast<uint32_t>(value);
+  for (unsigned byte = 0; byte < 4; ++byte) {
+    WriteByte(out, static_cast<uint8_t>(bits));
+    bits >>= 8U;
+  }
+}
+
+[[noreturn]] void Fail(const std::string_view reason) {
+  throw std::runtime_error(
+      std::string("invalid input recording: ").append(reason));
+}
+
+auto ReadByte(std::istream &in) -> uint8_t {
+  const auto value = in.get();
+  if (value == std::istream::traits_type::eof()) {
+    Fail("truncated log");
+  }
+  return static_cast<uint8_t>(value);
+}
+
+auto ReadVarint(std::istream &in) -> uint64_t {
+  uint64_t value{0};
+  for (unsigned shift = 0; shift < 64; shift += 7) {
+    const auto byte = ReadByte(in);
+    value |= static_cast<uint64_t>(byte & 0x7FU) << shift;
+    if ((byte & 0x80U) == 0) {
+      return value;
+    }
+  }
+  Fail("integer too long");
+}
+
+auto ReadSigned(std::istream &in) -> int64_t {
+  const auto value = ReadVarint(in);
+  return static_cast<int64_t>(value >> 1U) ^ -static_cast<int64_t>(value & 1U);
+}
+
+auto ReadFloat(std::istream &in) -> float {
+  uint32_t bits{0};
+  for (unsigned byte = 0; byte < 4; ++byte) {
+    bits |= static_cast<uint32_t>(ReadByte(in)) << (8U * byte);
+  }
+  return std::bit_cast<float>(bits);
+}
+
+auto ReadPosition(std::istream &in) -> oxygen::SubPixelPosition {
+  const auto x = ReadFloat(in);
+  return {.x = x, .y = ReadFloat(in)};
+}
+
+auto ReadMotion(std::istream &in) -> oxygen::SubPixelMotion {
+  const auto dx = ReadFloat(in);
+  return {.dx = dx, .dy = ReadFloat(in)};
+}
+
+auto ReadPayload(std::istream &in, const TimePoint time) -> InputEvent {
+  switch (static_cast<InputEventType>(ReadByte(in))) {
+  case InputEventType::kKeyEvent: {
+    const auto key = static_cast<Key>(ReadByte(in));
+    const auto flags = ReadByte(in);
+    return {nullptr, time,
+        KeyEvent(KeyEvent::KeyInfo(key, (flags & kRepeatBit) != 0),
+            (flags & kPressedBit) != 0 ? ButtonState::kPressed
+                                       : ButtonState::kReleased)};
+  }
+  case InputEventType::kMouseButtonEvent: {
+    const auto position = ReadPosition(in);
+    const auto button = static_cast<MouseButton>(ReadByte(in));
+    const auto state = (ReadByte(in) & kPressedBit) != 0
+                           ? ButtonState::kPressed
+                           : ButtonState::kReleased;
+    return {nullptr, time, MouseButtonEvent(position, button, state)};
+  }
+  case InputEventType::kMouseMotionEvent: {
+    const auto position = ReadPosition(in);
+    return {nullptr, time, MouseMotionEvent(position, ReadMotion(in))};
+  }
+  case InputEventType::kMouseWheelEvent: {
+    const auto position = ReadPosition(in);
+    return {nullptr, time, MouseWheelEvent(position, ReadMotion(in))};
+  }
+  }
+  Fail("unknown event type");
+}
+
+} // namespace
+
+InputRecorder::InputRecorder(std::ostream &out) : out_(out) {
+  out_.write(kMagic.data(), kMagic.size());
+  WriteByte(out_, kVersion);
+}
+
+void InputRecorder::RecordFrame(
+    const Duration frame_duration, const std::span<const InputEvent> events) {
+  WriteVarint(out_,
+      static_cast<uint64_t>(std::max(frame_duration, Duration::zero()).count()));
+  WriteVarint(out_, events.size());
+  for (const auto &event : events) {
+    Write(event);
+  }
+  ++frame_;
+}
+
+void InputRecorder::Write(const InputEvent &event) {
+  WriteSigned(out_, (event.GetTime() - last_time_).count());
+  WriteVarint(out_, event.GetWindowId());
+  WriteByte(out_, static_cast<uint8_t>(event.GetType()));
+  switch (event.GetType()) {
+  case InputEventType::kKeyEvent: {
+    const auto &key_event = event.As<KeyEvent>();
+    WriteByte(out_, static_cast<uint8_t>(key_event.GetKeyCode()));
+    WriteByte(out_,
+        (key_event.IsRepeat() ? kRepeatBit : 0U) |
+            (key_event.GetButtonState() == ButtonState::kPressed ? kPressedBit
+                                                                 : 0U));
+  } break;
+  case InputEventType::kMouseButtonEvent: {
+    const auto &button_event = event.As<MouseButtonEvent>();
+    WriteFloat(out_, button_event.GetPosition().x);
+    WriteFloat(out_, button_event.GetPosition().y);
+    WriteByte(out_, static_cast<uint8_t>(button_event.GetButton()));
+    WriteByte(out_,
+        button_event.GetButtonState() == ButtonState::kPressed ? kPressedBit
+                                                               : 0U);
+  } break;
+  case InputEventType::kMouseMotionEvent: {
+    const auto &motion_event = event.As<MouseMotionEvent>();
+    WriteFloat(out_, motion_event.GetPosition().x);
+    WriteFloat(out_, motion_event.GetPosition().y);
+    WriteFloat(out_, motion_event.GetMotion().dx);
+    WriteFloat(out_, motion_event.GetMotion().dy);
+  } break;
+  case InputEventType::kMouseWheelEvent: {
+    const auto &wheel_event = event.As<MouseWheelEvent>();
+    WriteFloat(out_, wheel_event.GetPosition().x);
+    WriteFloat(out_, wheel_event.GetPosition().y);
+    WriteFloat(out_, wheel_event.GetScrollAmount().dx);
+    WriteFloat(out_, wheel_event.GetScrollAmount().dy);
+  } break;
+  }
+  last_time_ = event.GetTime();
+  ++event_count_;
+}
+
+auto oxygen::platform::ReadInputRecording(std::istream &in)
+    -> InputRecording {
+  std::array<char, kMagic.size()> magic{};
+  in.read(magic.data(), magic.size());
+  if (!in || magic != kMagic) {
+    Fail("not an input recording");
+  }
+  if (ReadByte(in) != kVersion) {
+    Fail("unsupported version");
+  }
+
+  InputRecording recording;
+  TimePoint time{0};
+  while (in.peek() != std::istream::traits_type::eof()) {
+    const auto frame = recording.frame_durations.size();
+    recording.frame_durations.emplace_back(
+        static_cast<Duration::rep>(ReadVarint(in)));
+    const auto event_count = ReadVarint(in);
+    for (uint64_t index = 0; index < event_count; ++index) {
+      time += TimePoint(ReadSigned(in));
+      const auto window_id =
+          static_cast<oxygen::platform::WindowIdType>(ReadVarint(in));
+      auto event = ReadPayload(in, time);
+      event.SetWindowId(window_id);
+      recording.events.push_back({.frame = frame, .event = event});
+    }
+  }
+  return recording;
+}
@@ -0,0 +1,81 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <span>
+#include <vector>
+
+#include "oxygen/base/macros.h"
+#include "oxygen/base/types.h"
+#include "oxygen/platform/input_event.h"
+
+namespace oxygen::platform {
+
+//! An input event, with the index of the frame in which it was polled.
+struct RecordedInputEvent {
+  uint64_t frame;
+  InputEvent event;
+};
+
+//! The content of a log written by an `InputRecorder`.
+struct InputRecording {
+  //! Duration of each recorded frame, as measured by the engine clock.
+  std::vector<Duration> frame_durations{};
+  //! The input events, in the order they were polled.
+  std::vector<RecordedInputEvent> events{};
+};
+
+/*!
+ Writes the input events polled from the platform to a compact binary log, frame
+ by frame, to be replayed later.
+
+ Each frame is stored with its duration, so that a replay can reproduce the
+ time seen by the time based logic, such as the input triggers, and not only the
+ order of the events. Events are stored with their time stamp and window,
+ relative to the previous event and packed as variable length integers, which
+ makes a typical event a handful of bytes. Raw platform events are not
+ recorded.
+*/
+class InputRecorder {
+public:
+  //! Start a new log in `out`, which must outlive the recorder.
+  explicit InputRecorder(std::ostream &out);
+  ~InputRecorder() = default;
+
+  OXYGEN_MAKE_NON_COPYABLE(InputRecorder)
+  OXYGEN_MAKE_NON_MOVEABLE(InputRecorder)
+
+  //! Record the input events polled during one frame, and the duration of the
+  //! frame. Must be called for every frame, with or without events, so that
+  //! the frames can be reproduced.
+  void RecordFrame(Duration frame_duration, std::span<const InputEvent> events);
+
+  [[nodiscard]] auto FrameCount() const {
+    return frame_;
+  }
+  [[nodiscard]] auto EventCount() const {
+    return event_count_;
+  }
+
+private:
+  void Write(const InputEvent &event);
+
+  std::ostream &out_; // NOLINT(*-avoid-const-or-ref-data-members)
+  uint64_t frame_{0};
+  uint64_t event_count_{0};
+  // The time stamp of the previous event, the next one is recorded relative
+  // to it.
+  TimePoint last_time_{0};
+};
+
+//! Read a log written by `InputRecorder`, in the order it was recorded.
+//! \throws std::runtime_error if `in` does not hold a valid log.
+auto ReadInputRecording(std::istream &in) -> InputRecording;
+
+} // namespace oxygen::platform
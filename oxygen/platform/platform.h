@@ -7,12 +7,16 @@
 #pragma once
 
 #include <memory>
+#include <cstddef>
+#include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
 #include "sigslot/signal.hpp"
 
 #include "oxygen/base/macros.h"
+#include "oxygen/base/types.h"
 #include "oxygen/platform/display.h"
 #include "oxygen/platform/input_event.h"
 #include "oxygen/platform/types.h"
@@ -62,7 +66,42 @@ public:
 
   // -- Events -----------------------------------------------------------------
 
-  virtual auto PollEvent() -> std::unique_ptr<platform::InputEvent> = 0;
+  virtual auto PollEvent() -> std::optional<platform::InputEvent> = 0;
+
+  /*!
+   Drain the events pending in the platform queue, copying up to
+   `events.size()` input events to `events` in the order they were received.
+   The remaining input events are kept for the next call. Non-input events are
+   dispatched through the platform signals as they are drained, exactly like
+   with `PollEvent()`.
+
+   The raw platform events referenced by the polled input events remain valid
+   until the next call to `NewFrame()`.
+
+   \return the number of input events copied to `events`.
+  */
+  virtual auto PollEvents(std::span<platform::InputEvent> events) -> size_t = 0;
+
+  //! Mark a frame boundary, releasing the input events polled so far with their
+  //! raw platform events.
+  virtual void NewFrame() = 0;
+
+  //! Number of input events dropped because the platform event queue was full.
+  [[nodiscard]] virtual auto DroppedEventCount() const -> size_t = 0;
+
+  /*!
+   Block the calling thread until an event is pending in the platform queue, or
+   until `timeout` expires. A negative `timeout` waits without limit. The
+   pending event is left in the queue, to be retrieved by the next poll.
+
+   \return `true` if an event is pending, `false` if the timeout expired or
+   the wait was interrupted by `Wake()`.
+  */
+  virtual auto WaitForEvents(Duration timeout) -> bool = 0;
+
+  //! Interrupt the current, or else the next, `WaitForEvents()`. May be called
+  //! from any thread.
+  virtual void Wake() = 0;
 
   // -- Slots ------------------------------------------------------------------
 
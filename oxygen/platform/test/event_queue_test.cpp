@@ -0,0 +1,178 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "oxygen/platform/event_queue.h"
+
+#include <array>
+#include <deque>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "oxygen/platform/input_event.h"
+#include "oxygen/platform/types.h"
+
+using oxygen::TimePoint;
+using oxygen::platform::ButtonState;
+using oxygen::platform::EventQueue;
+using oxygen::platform::InputEvent;
+using oxygen::platform::Key;
+using oxygen::platform::KeyEvent;
+
+using testing::ElementsAre;
+using testing::Eq;
+using testing::IsFalse;
+using testing::IsTrue;
+
+namespace {
+// Stands for the raw event of a platform.
+struct RawEvent {
+  int value;
+};
+
+auto MakeKeyEvent(const Key key) {
+  return InputEvent(nullptr, TimePoint{},
+      KeyEvent(KeyEvent::KeyInfo(key), ButtonState::kPressed));
+}
+
+auto RawValue(const InputEvent &event) {
+  return static_cast<const RawEvent *>(event.GetRawEvent())->value;
+}
+
+// Stands for the event queue of a platform, drained with `Pump()`.
+class RawEventSource {
+public:
+  explicit RawEventSource(std::deque<RawEvent> events)
+      : events_(std::move(events)) {
+  }
+
+  auto Poll(RawEvent &event) -> bool {
+    if (events_.empty()) {
+      return false;
+    }
+    event = events_.front();
+    events_.pop_front();
+    return true;
+  }
+
+  // Odd values are key presses, even ones key releases, and `0` is not an
+  // input event.
+  static auto Translate(const RawEvent &event) -> std::optional<InputEvent> {
+    if (event.value == 0) {
+      return {};
+    }
+    return InputEvent(nullptr, TimePoint{},
+        KeyEvent(KeyEvent::KeyInfo(Key::kA),
+            event.value % 2 == 1 ? ButtonState::kPressed
+                                 : ButtonState::kReleased));
+  }
+
+  [[nodiscard]] auto Size() const -> size_t {
+    return events_.size();
+  }
+
+private:
+  std::deque<RawEvent> events_;
+};
+
+auto Pump(EventQueue<RawEvent> &queue, RawEventSource &source) -> bool {
+  return queue.Pump(
+      [&source](RawEvent &event) { return source.Poll(event); },
+      RawEventSource::Translate);
+}
+
+template <size_t Count>
+auto PopRawValues(EventQueue<RawEvent> &queue) -> std::vector<int> {
+  std::array<InputEvent, Count> events;
+  const auto count = queue.Pop(events);
+  std::vector<int> values;
+  for (size_t index = 0; index < count; ++index) {
+    values.push_back(RawValue(events[index]));
+  }
+  return values;
+}
+} // namespace
+
+// NOLINTNEXTLINE
+TEST(EventQueueTest, PopsEventsInOrderWithTheirRawEvents) {
+  EventQueue<RawEvent> queue(4);
+  EXPECT_THAT(queue.Push(MakeKeyEvent(Key::kA), RawEvent{1}), IsTrue());
+  EXPECT_THAT(queue.Push(MakeKeyEvent(Key::kB), RawEvent{2}), IsTrue());
+  EXPECT_THAT(queue.Push(MakeKeyEvent(Key::kC), RawEvent{3}), IsTrue());
+  EXPECT_THAT(queue.Size(), Eq(3));
+
+  std::array<InputEvent, 2> events;
+  ASSERT_THAT(queue.Pop(events), Eq(2));
+  EXPECT_THAT(events[0].As<KeyEvent>().GetKeyCode(), Eq(Key::kA));
+  EXPECT_THAT(RawValue(events[0]), Eq(1));
+  EXPECT_THAT(events[1].As<KeyEvent>().GetKeyCode(), Eq(Key::kB));
+  EXPECT_THAT(RawValue(events[1]), Eq(2));
+
+  ASSERT_THAT(queue.Pop(events), Eq(1));
+  EXPECT_THAT(events[0].As<KeyEvent>().GetKeyCode(), Eq(Key::kC));
+  EXPECT_THAT(RawValue(events[0]), Eq(3));
+  EXPECT_THAT(queue.Pop(events), Eq(0));
+}
+
+// NOLINTNEXTLINE
+TEST(EventQueueTest, KeepsPoppedEventsUntilReleased) {
+  EventQueue<RawEvent> queue(2);
+  queue.Push(MakeKeyEvent(Key::kA), RawEvent{1});
+  queue.Push(MakeKeyEvent(Key::kB), RawEvent{2});
+
+  std::array<InputEvent, 2> events;
+  ASSERT_THAT(queue.Pop(events), Eq(2));
+  EXPECT_THAT(queue.Size(), Eq(0));
+  // The popped events still hold their slots, and their raw events.
+  EXPECT_THAT(queue.IsFull(), IsTrue());
+  EXPECT_THAT(queue.Push(MakeKeyEvent(Key::kC), RawEvent{3}), IsFalse());
+  EXPECT_THAT(RawValue(events[0]), Eq(1));
+  EXPECT_THAT(RawValue(events[1]), Eq(2));
+
+  queue.Release();
+  EXPECT_THAT(queue.IsFull(), IsFalse());
+  EXPECT_THAT(queue.Push(MakeKeyEvent(Key::kC), RawEvent{3}), IsTrue());
+  ASSERT_THAT(queue.Pop(events), Eq(1));
+  EXPECT_THAT(RawValue(events[0]), Eq(3));
+}
+
+// NOLINTNEXTLINE
+TEST(EventQueueTest, CountsDroppedEvents) {
+  EventQueue<RawEvent> queue(1);
+  EXPECT_THAT(queue.Push(MakeKeyEvent(Key::kA), RawEvent{1}), IsTrue());
+  EXPECT_THAT(queue.Push(MakeKeyEvent(Key::kB), RawEvent{2}), IsFalse());
+  EXPECT_THAT(queue.Push(MakeKeyEvent(Key::kC), RawEvent{3}), IsFalse());
+  EXPECT_THAT(queue.DroppedCount(), Eq(2));
+
+  std::array<InputEvent, 1> events;
+  ASSERT_THAT(queue.Pop(events), Eq(1));
+  EXPECT_THAT(events[0].As<KeyEvent>().GetKeyCode(), Eq(Key::kA));
+}
+
+// NOLINTNEXTLINE
+TEST(EventQueueTest, PumpLeavesTheOverflowWithThePlatform) {
+  EventQueue<RawEvent> queue(3);
+  RawEventSource source({{1}, {2}, {0}, {3}, {5}, {4}});
+
+  // The event without translation does not take a slot.
+  EXPECT_THAT(Pump(queue, source), IsFalse());
+  EXPECT_THAT(source.Size(), Eq(2));
+  EXPECT_THAT(PopRawValues<8>(queue), ElementsAre(1, 2, 3));
+
+  // Until released, the popped events still hold all the slots.
+  EXPECT_THAT(Pump(queue, source), IsFalse());
+  EXPECT_THAT(source.Size(), Eq(2));
+
+  queue.Release();
+  EXPECT_THAT(Pump(queue, source), IsTrue());
+  EXPECT_THAT(source.Size(), Eq(0));
+  // Nothing is lost, the last release included.
+  EXPECT_THAT(PopRawValues<8>(queue), ElementsAre(5, 4));
+  EXPECT_THAT(queue.DroppedCount(), Eq(0));
+}
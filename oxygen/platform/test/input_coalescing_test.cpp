@@ -0,0 +1,138 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "oxygen/platform/input_coalescing.h"
+
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "oxygen/platform/input_event.h"
+#include "oxygen/platform/types.h"
+
+using oxygen::TimePoint;
+using oxygen::platform::ButtonState;
+using oxygen::platform::CoalesceMouseEvents;
+using oxygen::platform::InputEvent;
+using oxygen::platform::InputEventType;
+using oxygen::platform::Key;
+using oxygen::platform::KeyEvent;
+using oxygen::platform::MouseButton;
+using oxygen::platform::MouseButtonEvent;
+using oxygen::platform::MouseMotionEvent;
+using oxygen::platform::MouseWheelEvent;
+using oxygen::platform::WindowIdType;
+
+using testing::Eq;
+using testing::SizeIs;
+
+namespace {
+auto MakeMotionEvent(const WindowIdType window_id, const TimePoint time,
+    const float x, const float dx, const float dy) {
+  InputEvent event(nullptr, time,
+      MouseMotionEvent({.x = x, .y = 0.0F}, {.dx = dx, .dy = dy}));
+  event.SetWindowId(window_id);
+  return event;
+}
+
+auto MakeWheelEvent(const WindowIdType window_id, const float dy) {
+  InputEvent event(nullptr, TimePoint{0},
+      MouseWheelEvent({.x = 0.0F, .y = 0.0F}, {.dx = 0.0F, .dy = dy}));
+  event.SetWindowId(window_id);
+  return event;
+}
+
+auto MakeClickEvent(const WindowIdType window_id, const float x) {
+  InputEvent event(nullptr, TimePoint{0},
+      MouseButtonEvent(
+          {.x = x, .y = 0.0F}, MouseButton::kLeft, ButtonState::kPressed));
+  event.SetWindowId(window_id);
+  return event;
+}
+
+auto MakeKeyEvent(const Key key) {
+  return InputEvent(nullptr, TimePoint{0},
+      KeyEvent(KeyEvent::KeyInfo(key), ButtonState::kPressed));
+}
+} // namespace
+
+// NOLINTNEXTLINE
+TEST(InputCoalescingTest, MergesMouseEventsOfEachWindow) {
+  std::vector events{
+      MakeMotionEvent(1, TimePoint{10}, 1.0F, 1.0F, 1.0F),
+      MakeWheelEvent(1, 1.0F),
+      MakeKeyEvent(Key::kA),
+      MakeMotionEvent(2, TimePoint{20}, 5.0F, 5.0F, 0.0F),
+      MakeMotionEvent(1, TimePoint{30}, 3.0F, 2.0F, -1.0F),
+      MakeWheelEvent(1, 2.0F),
+      MakeMotionEvent(1, TimePoint{40}, 4.0F, 0.5F, 0.5F),
+  };
+
+  EXPECT_THAT(CoalesceMouseEvents(events), Eq(3));
+  ASSERT_THAT(events, SizeIs(4));
+
+  EXPECT_THAT(events[0].As<KeyEvent>().GetKeyCode(), Eq(Key::kA));
+
+  EXPECT_THAT(events[1].GetWindowId(), Eq(2));
+  EXPECT_THAT(events[1].As<MouseMotionEvent>().GetMotion().dx, Eq(5.0F));
+
+  EXPECT_THAT(events[2].GetType(), Eq(InputEventType::kMouseWheelEvent));
+  EXPECT_THAT(events[2].GetWindowId(), Eq(1));
+  EXPECT_THAT(events[2].As<MouseWheelEvent>().GetScrollAmount().dy, Eq(3.0F));
+
+  // The merged motion has the sum of the motions, at the latest position.
+  EXPECT_THAT(events[3].GetWindowId(), Eq(1));
+  EXPECT_THAT(events[3].GetTime(), Eq(TimePoint{40}));
+  const auto &motion = events[3].As<MouseMotionEvent>();
+  EXPECT_THAT(motion.GetPosition().x, Eq(4.0F));
+  EXPECT_THAT(motion.GetMotion().dx, Eq(3.5F));
+  EXPECT_THAT(motion.GetMotion().dy, Eq(0.5F));
+}
+
+// NOLINTNEXTLINE
+TEST(InputCoalescingTest, KeepsOtherEventsUntouched) {
+  std::vector events{
+      MakeKeyEvent(Key::kA),
+      MakeMotionEvent(1, TimePoint{10}, 1.0F, 1.0F, 1.0F),
+      MakeKeyEvent(Key::kB),
+  };
+
+  EXPECT_THAT(CoalesceMouseEvents(events), Eq(0));
+  ASSERT_THAT(events, SizeIs(3));
+  EXPECT_THAT(events[0].As<KeyEvent>().GetKeyCode(), Eq(Key::kA));
+  EXPECT_THAT(events[1].GetType(), Eq(InputEventType::kMouseMotionEvent));
+  EXPECT_THAT(events[2].As<KeyEvent>().GetKeyCode(), Eq(Key::kB));
+}
+
+// NOLINTNEXTLINE
+TEST(InputCoalescingTest, DoesNotMergeAcrossOtherEventsOfTheWindow) {
+  std::vector events{
+      MakeMotionEvent(1, TimePoint{10}, 1.0F, 1.0F, 0.0F),
+      MakeMotionEvent(1, TimePoint{20}, 2.0F, 1.0F, 0.0F),
+      MakeClickEvent(1, 2.0F),
+      MakeMotionEvent(1, TimePoint{30}, 3.0F, 1.0F, 0.0F),
+      MakeClickEvent(2, 0.0F),
+      MakeMotionEvent(1, TimePoint{40}, 4.0F, 1.0F, 0.0F),
+  };
+
+  // Only the runs on each side of the click are merged, the click of another
+  // window does not end a run.
+  EXPECT_THAT(CoalesceMouseEvents(events), Eq(2));
+  ASSERT_THAT(events, SizeIs(4));
+
+  EXPECT_THAT(events[0].As<MouseMotionEvent>().GetPosition().x, Eq(2.0F));
+  EXPECT_THAT(events[0].As<MouseMotionEvent>().GetMotion().dx, Eq(2.0F));
+
+  EXPECT_THAT(events[1].GetWindowId(), Eq(1));
+  EXPECT_THAT(events[1].GetType(), Eq(InputEventType::kMouseButtonEvent));
+  EXPECT_THAT(events[2].GetWindowId(), Eq(2));
+  EXPECT_THAT(events[2].GetType(), Eq(InputEventType::kMouseButtonEvent));
+
+  EXPECT_THAT(events[3].GetTime(), Eq(TimePoint{40}));
+  EXPECT_THAT(events[3].As<MouseMotionEvent>().GetPosition().x, Eq(4.0F));
+  EXPECT_THAT(events[3].As<MouseMotionEvent>().GetMotion().dx, Eq(2.0F));
+}
@@ -0,0 +1,116 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "oxygen/platform/input_recording.h"
+
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "oxygen/platform/input_event.h"
+#include "oxygen/platform/types.h"
+
+using oxygen::Duration;
+using oxygen::TimePoint;
+using oxygen::platform::ButtonState;
+using oxygen::platform::InputEvent;
+using oxygen::platform::InputEventType;
+using oxygen::platform::InputRecorder;
+using oxygen::platform::Key;
+using oxygen::platform::KeyEvent;
+using oxygen::platform::MouseButton;
+using oxygen::platform::MouseButtonEvent;
+using oxygen::platform::MouseMotionEvent;
+using oxygen::platform::MouseWheelEvent;
+using oxygen::platform::ReadInputRecording;
+
+using testing::ElementsAre;
+using testing::Eq;
+using testing::IsEmpty;
+using testing::IsTrue;
+using testing::SizeIs;
+
+// NOLINTNEXTLINE
+TEST(InputRecordingTest, RoundTripsEventsFrameByFrame) {
+  InputEvent key(nullptr, TimePoint{1'000},
+      KeyEvent(KeyEvent::KeyInfo(Key::kSpace, true), ButtonState::kPressed));
+  key.SetWindowId(7);
+  const InputEvent button(nullptr, TimePoint{1'500},
+      MouseButtonEvent(
+          {.x = 10.5F, .y = 20.0F}, MouseButton::kRight, ButtonState::kPressed));
+  const InputEvent motion(nullptr, TimePoint{900},
+      MouseMotionEvent({.x = 1.0F, .y = 2.0F}, {.dx = -3.25F, .dy = 4.0F}));
+  const InputEvent wheel(nullptr, TimePoint{90'000'000},
+      MouseWheelEvent({.x = 5.0F, .y = 6.0F}, {.dx = 0.0F, .dy = -1.0F}));
+
+  std::stringstream log;
+  InputRecorder recorder(log);
+  recorder.RecordFrame(Duration(16'667), std::vector{key, button});
+  recorder.RecordFrame(Duration(5'000), {});
+  recorder.RecordFrame(Duration(40'000), std::vector{motion, wheel});
+  EXPECT_THAT(recorder.FrameCount(), Eq(3));
+  EXPECT_THAT(recorder.EventCount(), Eq(4));
+
+  const auto recording = ReadInputRecording(log);
+  EXPECT_THAT(recording.frame_durations,
+      ElementsAre(Duration(16'667), Duration(5'000), Duration(40'000)));
+  const auto &events = recording.events;
+  ASSERT_THAT(events, SizeIs(4));
+
+  EXPECT_THAT(events[0].frame, Eq(0));
+  EXPECT_THAT(events[0].event.GetType(), Eq(InputEventType::kKeyEvent));
+  EXPECT_THAT(events[0].event.GetTime(), Eq(TimePoint{1'000}));
+  EXPECT_THAT(events[0].event.GetWindowId(), Eq(7));
+  const auto &key_event = events[0].event.As<KeyEvent>();
+  EXPECT_THAT(key_event.GetKeyCode(), Eq(Key::kSpace));
+  EXPECT_THAT(key_event.IsRepeat(), IsTrue());
+  EXPECT_THAT(key_event.GetButtonState(), Eq(ButtonState::kPressed));
+
+  EXPECT_THAT(events[1].frame, Eq(0));
+  const auto &button_event = events[1].event.As<MouseButtonEvent>();
+  EXPECT_THAT(button_event.GetPosition().x, Eq(10.5F));
+  EXPECT_THAT(button_event.GetButton(), Eq(MouseButton::kRight));
+  EXPECT_THAT(button_event.GetButtonState(), Eq(ButtonState::kPressed));
+
+  // Time stamps are not required to increase.
+  EXPECT_THAT(events[2].frame, Eq(2));
+  EXPECT_THAT(events[2].event.GetTime(), Eq(TimePoint{900}));
+  EXPECT_THAT(
+      events[2].event.As<MouseMotionEvent>().GetMotion().dx, Eq(-3.25F));
+
+  EXPECT_THAT(events[3].frame, Eq(2));
+  EXPECT_THAT(events[3].event.GetTime(), Eq(TimePoint{90'000'000}));
+  EXPECT_THAT(
+      events[3].event.As<MouseWheelEvent>().GetScrollAmount().dy, Eq(-1.0F));
+}
+
+// NOLINTNEXTLINE
+TEST(InputRecordingTest, ReadsAnEmptyLog) {
+  std::stringstream log;
+  const InputRecorder recorder(log);
+  const auto recording = ReadInputRecording(log);
+  EXPECT_THAT(recording.frame_durations, IsEmpty());
+  EXPECT_THAT(recording.events, IsEmpty());
+}
+
+// NOLINTNEXTLINE
+TEST(InputRecordingTest, RejectsInvalidLogs) {
+  std::stringstream not_a_log("not an input log");
+  EXPECT_THROW(ReadInputRecording(not_a_log), std::runtime_error);
+
+  std::stringstream log;
+  InputRecorder recorder(log);
+  const InputEvent key(nullptr, TimePoint{1},
+      KeyEvent(KeyEvent::KeyInfo(Key::kA), ButtonState::kPressed));
+  recorder.RecordFrame(Duration(1'000), std::vector{key});
+  auto truncated = log.str();
+  truncated.pop_back();
+  std::stringstream truncated_log(truncated);
+  EXPECT_THROW(ReadInputRecording(truncated_log), std::runtime_error);
+}
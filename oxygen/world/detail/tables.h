@@ -0,0 +1,30 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "glm/glm.hpp"
+#include "glm/gtc/quaternion.hpp"
+#include "oxygen/base/resource_table.h"
+#include "oxygen/world/types.h"
+
+// Internal access to the tables storing the world's entities and components.
+// Only meant for code that needs to operate on whole columns at once, such as
+// the scene file loader and writer. Everything else should go through the
+// public API of entities and components.
+
+namespace oxygen::world::detail {
+
+auto EntityTable() -> ResourceTable<Entity> &;
+
+// The transform tables are always modified together, and therefore share the
+// same layout of their sparse, dense and meta sets.
+auto TransformTable() -> ResourceTable<Transform> &;
+auto PositionTable() -> ResourceTable<glm::vec3> &;
+auto RotationTable() -> ResourceTable<glm::quat> &;
+auto ScaleTable() -> ResourceTable<glm::vec3> &;
+
+} // namespace oxygen::world::detail
@@ -7,6 +7,7 @@
 #include "entity.h"
 
 #include "oxygen/base/resource_table.h"
+#include "oxygen/world/detail/tables.h"
 #include "transform.h"
 
 namespace {
@@ -14,6 +15,10 @@ oxygen::ResourceTable<oxygen::world::Entity> entities(
     oxygen::world::resources::kEntity, 256);
 }
 
+auto oxygen::world::detail::EntityTable() -> ResourceTable<Entity> & {
+  return entities;
+}
+
 auto oxygen::world::entity::CreateGameEntity(
     const Descriptor &entity_desc) -> Entity {
   // All game entities must have a transform component.
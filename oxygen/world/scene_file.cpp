@@ -0,0 +1,393 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "scene_file.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "oxygen/base/platform.h"
+#include "oxygen/world/detail/tables.h"
+#include "oxygen/world/entity.h"
+#include "oxygen/world/transform.h"
+
+#if defined(OXYGEN_WINDOWS)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using oxygen::ResourceHandle;
+using oxygen::ResourceTable;
+using oxygen::world::scene::ColumnDescriptor;
+using oxygen::world::scene::ColumnId;
+using oxygen::world::scene::FileHeader;
+using oxygen::world::scene::kColumnAlignment;
+using oxygen::world::scene::kFileVersion;
+using oxygen::world::scene::Status;
+
+namespace {
+
+// Read-only view of a whole file mapped in memory.
+class MappedFile {
+public:
+  explicit MappedFile(const std::filesystem::path &path) {
+#if defined(OXYGEN_WINDOWS)
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+        nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+      return;
+    }
+    LARGE_INTEGER file_size{};
+    if (GetFileSizeEx(file, &file_size) == FALSE) {
+      CloseHandle(file);
+      return;
+    }
+    is_open_ = true;
+    size_ = static_cast<size_t>(file_size.QuadPart);
+    if (size_ != 0) {
+      HANDLE mapping =
+          CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      if (mapping != nullptr) {
+        data_ = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        // The view keeps a reference on the mapping object.
+        CloseHandle(mapping);
+      }
+      is_open_ = (data_ != nullptr);
+    }
+    CloseHandle(file);
+#else
+    const int file = open(path.c_str(), O_RDONLY);
+    if (file < 0) {
+      return;
+    }
+    struct stat file_stat {};
+    if (fstat(file, &file_stat) != 0) {
+      close(file);
+      return;
+    }
+    is_open_ = true;
+    size_ = static_cast<size_t>(file_stat.st_size);
+    if (size_ != 0) {
+      data_ = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file, 0);
+      if (data_ == MAP_FAILED) {
+        data_ = nullptr;
+        is_open_ = false;
+      }
+    }
+    // The mapping stays valid after the file descriptor is closed.
+    close(file);
+#endif
+  }
+
+  ~MappedFile() {
+    if (data_ == nullptr) {
+      return;
+    }
+#if defined(OXYGEN_WINDOWS)
+    UnmapViewOfFile(data_);
+#else
+    munmap(data_, size_);
+#endif
+  }
+
+  MappedFile(const MappedFile &) = delete;
+  auto operator=(const MappedFile &) -> MappedFile & = delete;
+  MappedFile(MappedFile &&) = delete;
+  auto operator=(MappedFile &&) -> MappedFile & = delete;
+
+  [[nodiscard]] auto IsOpen() const -> bool {
+    return is_open_;
+  }
+
+  [[nodiscard]] auto Bytes() const -> std::span<const std::byte> {
+    return {static_cast<const std::byte *>(data_), size_};
+  }
+
+private:
+  void *data_{nullptr};
+  size_t size_{0};
+  bool is_open_{false};
+};
+
+constexpr auto AlignUp(const uint64_t value) -> uint64_t {
+  return (value + kColumnAlignment - 1) & ~uint64_t{kColumnAlignment - 1};
+}
+
+// The meta sets of all tables have the same layout, regardless of the item
+// type, and are stored in a single column.
+using EntityMeta = ResourceTable<oxygen::world::Entity>::Meta;
+static_assert(std::is_trivially_copyable_v<EntityMeta>);
+static_assert(sizeof(EntityMeta) == sizeof(uint32_t));
+static_assert(std::is_trivially_copyable_v<glm::vec3>);
+static_assert(std::is_trivially_copyable_v<glm::quat>);
+
+template <typename T>
+auto ToRawHandles(const ResourceTable<T> &table)
+    -> std::vector<ResourceHandle::HandleT> {
+  std::vector<ResourceHandle::HandleT> raw_handles;
+  raw_handles.reserve(table.SparseItems().size());
+  std::ranges::transform(table.SparseItems(), std::back_inserter(raw_handles),
+      [](const ResourceHandle &handle) { return handle.Handle(); });
+  return raw_handles;
+}
+
+struct ColumnSource {
+  ColumnId id;
+  uint32_t element_size;
+  const void *data;
+  uint64_t size;
+};
+
+template <typename T>
+auto MakeColumnSource(const ColumnId id, std::span<const T> items)
+    -> ColumnSource {
+  return {
+      .id = id,
+      .element_size = static_cast<uint32_t>(sizeof(T)),
+      .data = items.data(),
+      .size = items.size_bytes(),
+  };
+}
+
+// Build the complete file content in memory. This is only a sequence of bulk
+// copies of the world columns, and is the only part of saving that needs to
+// be synchronized with the world modifications.
+auto MakeImage() -> std::vector<std::byte> {
+  using namespace oxygen::world::detail;
+
+  const auto &entities = EntityTable();
+  const auto &transforms = TransformTable();
+  assert(entities.Size() == transforms.Size());
+  assert(entities.SparseItems().size() == transforms.SparseItems().size());
+  assert(entities.FreeListFront() == transforms.FreeListFront());
+  assert(PositionTable().Size() == transforms.Size());
+  assert(RotationTable().Size() == transforms.Size());
+  assert(ScaleTable().Size() == transforms.Size());
+
+  const auto entity_sparse = ToRawHandles(entities);
+  const auto transform_sparse = ToRawHandles(transforms);
+
+  const std::array columns{
+      MakeColumnSource(
+          ColumnId::kEntitySparse, std::span<const uint64_t>(entity_sparse)),
+      MakeColumnSource(ColumnId::kTransformSparse,
+          std::span<const uint64_t>(transform_sparse)),
+      MakeColumnSource(ColumnId::kMeta, entities.MetaItems()),
+      MakeColumnSource(ColumnId::kPositions, PositionTable().Items()),
+      MakeColumnSource(ColumnId::kRotations, RotationTable().Items()),
+      MakeColumnSource(ColumnId::kScales, ScaleTable().Items()),
+  };
+
+  const FileHeader header{
+      .column_count = static_cast<uint32_t>(columns.size()),
+      .sparse_count = static_cast<uint32_t>(entity_sparse.size()),
+      .dense_count = static_cast<uint32_t>(entities.Size()),
+      .freelist_front = entities.FreeListFront(),
+      .freelist_back = entities.FreeListBack(),
+  };
+
+  std::array<ColumnDescriptor, columns.size()> descriptors{};
+  uint64_t offset =
+      AlignUp(sizeof(FileHeader) + sizeof(ColumnDescriptor) * columns.size());
+  for (size_t index = 0; index < columns.size(); ++index) {
+    descriptors[index] = {
+        .id = columns[index].id,
+        .element_size = columns[index].element_size,
+        .offset = offset,
+        .size = columns[index].size,
+    };
+    offset = AlignUp(offset + columns[index].size);
+  }
+
+  std::vector<std::byte> image(offset);
+  std::memcpy(image.data(), &header, sizeof(header));
+  std::memcpy(image.data() + sizeof(header), descriptors.data(),
+      sizeof(ColumnDescriptor) * descriptors.size());
+  for (size_t index = 0; index < columns.size(); ++index) {
+    if (columns[index].size != 0) {
+      std::memcpy(image.data() + descriptors[index].offset,
+          columns[index].data, columns[index].size);
+    }
+  }
+  return image;
+}
+
+auto WriteImage(const std::filesystem::path &path,
+    const std::vector<std::byte> &image) -> Status {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file) {
+    return Status::kCannotOpenFile;
+  }
+  file.write(reinterpret_cast<const char *>(image.data()),
+      static_cast<std::streamsize>(image.size()));
+  file.flush();
+  return file ? Status::kSuccess : Status::kCannotWriteFile;
+}
+
+// Validated location of a column inside the mapped file.
+struct ColumnView {
+  const std::byte *data{nullptr};
+  uint64_t count{0};
+
+  template <typename T> [[nodiscard]] auto As() const -> std::span<const T> {
+    // The mapping is page aligned and columns are aligned in the file, so the
+    // column data can be used in place.
+    assert(reinterpret_cast<uintptr_t>(data) % alignof(T) == 0);
+    return {reinterpret_cast<const T *>(data), static_cast<size_t>(count)};
+  }
+};
+
+auto ExpectedElementSize(const ColumnId id) -> std::optional<uint32_t> {
+  switch (id) {
+  case ColumnId::kEntitySparse:
+  case ColumnId::kTransformSparse:
+    return sizeof(ResourceHandle::HandleT);
+  case ColumnId::kMeta:
+    return sizeof(EntityMeta);
+  case ColumnId::kPositions:
+  case ColumnId::kScales:
+    return sizeof(glm::vec3);
+  case ColumnId::kRotations:
+    return sizeof(glm::quat);
+  }
+  return std::nullopt;
+}
+
+} // namespace
+
+auto oxygen::world::scene::Load(const std::filesystem::path &path) -> Status {
+  const MappedFile file(path);
+  if (!file.IsOpen()) {
+    return Status::kCannotOpenFile;
+  }
+  const auto bytes = file.Bytes();
+
+  FileHeader header{};
+  if (bytes.size() < sizeof(header)) {
+    return Status::kNotASceneFile;
+  }
+  std::memcpy(&header, bytes.data(), sizeof(header));
+  if (header.magic != FileHeader::kMagic) {
+    return Status::kNotASceneFile;
+  }
+  if (header.byte_order != FileHeader::kByteOrderMark ||
+      header.version == 0 || header.version > kFileVersion) {
+    return Status::kUnsupportedVersion;
+  }
+
+  const uint64_t descriptors_end = sizeof(header) +
+                                   uint64_t{header.column_count} *
+                                       sizeof(ColumnDescriptor);
+  if (descriptors_end > bytes.size() ||
+      header.dense_count > header.sparse_count) {
+    return Status::kCorruptedFile;
+  }
+
+  // Locate and validate all the columns before touching the world.
+  constexpr size_t kColumnsCount = static_cast<size_t>(ColumnId::kScales);
+  std::array<std::optional<ColumnView>, kColumnsCount + 1> columns{};
+  for (uint32_t index = 0; index < header.column_count; ++index) {
+    ColumnDescriptor descriptor{};
+    std::memcpy(&descriptor,
+        bytes.data() + sizeof(header) + index * sizeof(ColumnDescriptor),
+        sizeof(descriptor));
+
+    const auto element_size = ExpectedElementSize(descriptor.id);
+    if (!element_size) {
+      // Unknown column, added by a newer version of the format.
+      continue;
+    }
+    const uint64_t count = (descriptor.id == ColumnId::kEntitySparse ||
+                               descriptor.id == ColumnId::kTransformSparse)
+                               ? header.sparse_count
+                               : header.dense_count;
+    if (descriptor.element_size != *element_size ||
+        descriptor.size != count * *element_size ||
+        descriptor.offset % kColumnAlignment != 0 ||
+        descriptor.offset > bytes.size() ||
+        descriptor.size > bytes.size() - descriptor.offset) {
+      return Status::kCorruptedFile;
+    }
+    columns[static_cast<size_t>(descriptor.id)] = ColumnView{
+        .data = bytes.data() + descriptor.offset,
+        .count = count,
+    };
+  }
+  if (std::any_of(columns.begin() + 1, columns.end(),
+          [](const auto &column) { return !column.has_value(); })) {
+    return Status::kCorruptedFile;
+  }
+
+  const auto column = [&columns](ColumnId id) -> const ColumnView & {
+    return *columns[static_cast<size_t>(id)];
+  };
+  const auto entity_sparse =
+      column(ColumnId::kEntitySparse).As<ResourceHandle::HandleT>();
+  const auto transform_sparse =
+      column(ColumnId::kTransformSparse).As<ResourceHandle::HandleT>();
+  const auto &meta = column(ColumnId::kMeta);
+
+  // Entities and transforms carry no data other than their handle, which is
+  // fully described by the sparse set.
+  const std::vector<Entity> entity_items(header.dense_count);
+  const std::vector<Transform> transform_items(header.dense_count);
+
+  using namespace detail;
+  const auto front = header.freelist_front;
+  const auto back = header.freelist_back;
+  const bool restored =
+      EntityTable().Restore(entity_sparse,
+          meta.As<ResourceTable<Entity>::Meta>(), entity_items, front, back) &&
+      TransformTable().Restore(transform_sparse,
+          meta.As<ResourceTable<Transform>::Meta>(), transform_items, front,
+          back) &&
+      PositionTable().Restore(transform_sparse,
+          meta.As<ResourceTable<glm::vec3>::Meta>(),
+          column(ColumnId::kPositions).As<glm::vec3>(), front, back) &&
+      RotationTable().Restore(transform_sparse,
+          meta.As<ResourceTable<glm::quat>::Meta>(),
+          column(ColumnId::kRotations).As<glm::quat>(), front, back) &&
+      ScaleTable().Restore(transform_sparse,
+          meta.As<ResourceTable<glm::vec3>::Meta>(),
+          column(ColumnId::kScales).As<glm::vec3>(), front, back);
+  if (!restored) {
+    // Never leave the world with tables out of sync.
+    EntityTable().Reset();
+    TransformTable().Reset();
+    PositionTable().Reset();
+    RotationTable().Reset();
+    ScaleTable().Reset();
+    return Status::kCorruptedFile;
+  }
+  return Status::kSuccess;
+}
+
+auto oxygen::world::scene::Save(const std::filesystem::path &path) -> Status {
+  return WriteImage(path, MakeImage());
+}
+
+auto oxygen::world::scene::SaveAsync(const std::filesystem::path &path)
+    -> std::future<Status> {
+  return std::async(std::launch::async,
+      [path, image = MakeImage()]() { return WriteImage(path, image); });
+}
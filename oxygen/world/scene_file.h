@@ -0,0 +1,114 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <future>
+
+/*
+Binary scene file format.
+
+A scene file is a snapshot of the world tables, stored as contiguous columns
+that can be copied in bulk into the tables when loading, instead of going
+through the per-entity creation path. The file starts with a fixed size header,
+followed by a table of column descriptors, followed by the column data. Each
+column starts at an offset aligned to `kColumnAlignment` bytes, so that it can
+be used in place once the file is mapped in memory.
+
+   +----------------+-------------------------+--------+-----+--------+
+   | FileHeader     | ColumnDescriptor[count] | column | ... | column |
+   +----------------+-------------------------+--------+-----+--------+
+
+Entities and their transforms are always created and removed together, and
+their tables share the same layout. The file stores the sparse set of each
+table (raw handle values, which include the generations), a single meta column
+(dense to sparse index), and one dense column per transform component. This is
+what makes handles survive a round trip: a handle obtained before saving refers
+to the same entity after loading.
+
+Columns are stored in the native memory layout of their element type. The
+header records the byte order, and each descriptor records the element size,
+so that a file produced by an incompatible build is rejected instead of being
+misinterpreted. Columns with an unknown id are skipped by the loader, which
+leaves room for new data (e.g. the scene hierarchy) without breaking older
+files.
+*/
+
+namespace oxygen::world::scene {
+
+constexpr uint32_t kFileVersion = 1;
+constexpr uint32_t kColumnAlignment = 16;
+
+enum class ColumnId : uint32_t {
+  kEntitySparse = 1,    // ResourceHandle::HandleT[sparse_count]
+  kTransformSparse = 2, // ResourceHandle::HandleT[sparse_count]
+  kMeta = 3,            // uint32_t[dense_count], dense to sparse index
+  kPositions = 4,       // glm::vec3[dense_count]
+  kRotations = 5,       // glm::quat[dense_count]
+  kScales = 6,          // glm::vec3[dense_count]
+};
+
+struct FileHeader {
+  static constexpr uint32_t kMagic = 0x4353584F; // "OXSC" in little endian
+  static constexpr uint32_t kByteOrderMark = 0x01020304;
+
+  uint32_t magic{kMagic};
+  uint32_t byte_order{kByteOrderMark};
+  uint32_t version{kFileVersion};
+  uint32_t column_count{0};
+  uint32_t sparse_count{0};
+  uint32_t dense_count{0};
+  uint32_t freelist_front{0};
+  uint32_t freelist_back{0};
+};
+
+struct ColumnDescriptor {
+  ColumnId id;
+  uint32_t element_size;
+  uint64_t offset; // From the start of the file
+  uint64_t size;   // In bytes
+};
+
+enum class Status : uint8_t {
+  kSuccess,
+  kCannotOpenFile,
+  kCannotWriteFile,
+  kNotASceneFile,
+  kUnsupportedVersion,
+  kCorruptedFile,
+};
+
+/*
+Load the scene file at `path`, replacing the entire content of the world. The
+file is mapped in memory and its columns are copied in bulk into the world
+tables.
+
+The file is fully validated before the world is touched; if it cannot be
+loaded, the world is left untouched, except for a file with inconsistent
+content in a table, in which case the world is left empty.
+*/
+auto Load(const std::filesystem::path &path) -> Status;
+
+/*
+Save the current world to the scene file at `path`, overwriting it if it
+exists.
+*/
+auto Save(const std::filesystem::path &path) -> Status;
+
+/*
+Save the current world to the scene file at `path` without waiting for the
+file to be written.
+
+The world columns are snapshotted into a single memory image on the calling
+thread, which is only a sequence of bulk copies, and the image is streamed to
+disk on a worker thread. The world can be modified as soon as this function
+returns.
+*/
+auto SaveAsync(const std::filesystem::path &path) -> std::future<Status>;
+
+} // namespace oxygen::world::scene
@@ -4,6 +4,8 @@
 // SPDX-License-Identifier: BSD-3-Clause
 //===----------------------------------------------------------------------===//
 
+#include <array>
+
 #include "gtest/gtest.h"
 
 #include "oxygen/world/entity.h"
@@ -17,6 +19,10 @@ using oxygen::world::TransformDescriptor;
 using oxygen::world::TransformId;
 using oxygen::world::entity::CreateGameEntity;
 using oxygen::world::entity::RemoveGameEntity;
+using oxygen::world::transform::Field;
+using oxygen::world::transform::FrameDeltas;
+using oxygen::world::transform::FrameDeltasOverflowed;
+using oxygen::world::transform::kMaxFrameDeltas;
 
 // NOLINTNEXTLINE
 TEST(EntityComponentTest, CanCreateAndRemoveEntity) {
@@ -62,3 +68,84 @@ TEST(EntityComponentTest, RemoveEntityRemovesTransform) {
   ASSERT_EQ(removed, 1);
   ASSERT_FALSE(transform.IsValid());
 }
+
+// NOLINTNEXTLINE
+TEST(EntityComponentTest, SetTransformFieldsRecordsDeltas) {
+  TransformDescriptor tranform_desc{};
+  EntityDescriptor entity_desc{
+      .transform = &tranform_desc,
+  };
+  auto entity = CreateGameEntity(entity_desc);
+  ASSERT_TRUE(entity.IsValid());
+  auto transform = entity.GetTransform();
+  oxygen::world::transform::EndFrame();
+
+  transform.SetPosition({1.F, 2.F, 3.F});
+  transform.SetScale({1.F, 1.F, 1.F}); // Unchanged, not recorded
+  ASSERT_EQ(transform.GetPosition(), glm::vec3(1.F, 2.F, 3.F));
+  // Deltas are only visible once the frame has ended.
+  ASSERT_TRUE(FrameDeltas().empty());
+
+  oxygen::world::transform::EndFrame();
+  ASSERT_EQ(FrameDeltas().size(), 1);
+  const auto &delta = FrameDeltas().front();
+  ASSERT_EQ(delta.handle, transform.GetId().Handle());
+  ASSERT_EQ(delta.field, Field::kPosition);
+  ASSERT_EQ(delta.value[0], 1.F);
+  ASSERT_EQ(delta.value[1], 2.F);
+  ASSERT_EQ(delta.value[2], 3.F);
+
+  oxygen::world::transform::EndFrame();
+  ASSERT_TRUE(FrameDeltas().empty());
+  RemoveGameEntity(entity);
+}
+
+// NOLINTNEXTLINE
+TEST(EntityComponentTest, BatchSetTransformFieldsRecordsDeltas) {
+  TransformDescriptor tranform_desc{};
+  EntityDescriptor entity_desc{
+      .transform = &tranform_desc,
+  };
+  const std::array transforms{
+      CreateGameEntity(entity_desc).GetTransform(),
+      CreateGameEntity(entity_desc).GetTransform(),
+  };
+  oxygen::world::transform::EndFrame();
+
+  const std::array scales{glm::vec3(2.F, 2.F, 2.F), glm::vec3(3.F, 3.F, 3.F)};
+  oxygen::world::transform::SetScales(transforms, scales);
+  oxygen::world::transform::EndFrame();
+
+  ASSERT_EQ(FrameDeltas().size(), 2);
+  for (size_t index = 0; index < transforms.size(); ++index) {
+    ASSERT_EQ(transforms[index].GetScale(), scales[index]);
+    ASSERT_EQ(FrameDeltas()[index].handle, transforms[index].GetId().Handle());
+    ASSERT_EQ(FrameDeltas()[index].field, Field::kScale);
+  }
+}
+
+// NOLINTNEXTLINE
+TEST(EntityComponentTest, FrameDeltasAreCapped) {
+  TransformDescriptor tranform_desc{};
+  EntityDescriptor entity_desc{
+      .transform = &tranform_desc,
+  };
+  auto entity = CreateGameEntity(entity_desc);
+  auto transform = entity.GetTransform();
+  oxygen::world::transform::EndFrame();
+
+  // One change more than the limit, each one moving the transform.
+  for (size_t index = 1; index <= kMaxFrameDeltas + 1; ++index) {
+    transform.SetPosition({static_cast<float>(index % 2), 0.F, 0.F});
+  }
+  // The last change is applied, but not recorded.
+  ASSERT_EQ(transform.GetPosition(), glm::vec3(1.F, 0.F, 0.F));
+  oxygen::world::transform::EndFrame();
+  ASSERT_EQ(FrameDeltas().size(), kMaxFrameDeltas);
+  ASSERT_TRUE(FrameDeltasOverflowed());
+
+  oxygen::world::transform::EndFrame();
+  ASSERT_TRUE(FrameDeltas().empty());
+  ASSERT_FALSE(FrameDeltasOverflowed());
+  RemoveGameEntity(entity);
+}
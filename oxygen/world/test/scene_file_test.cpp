@@ -0,0 +1,135 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "oxygen/world/scene_file.h"
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "oxygen/world/entity.h"
+#include "oxygen/world/transform.h"
+
+using oxygen::world::Entity;
+using oxygen::world::EntityDescriptor;
+using oxygen::world::Transform;
+using oxygen::world::TransformDescriptor;
+using oxygen::world::entity::CreateGameEntity;
+using oxygen::world::entity::RemoveGameEntity;
+namespace scene = oxygen::world::scene;
+
+namespace {
+
+class SceneFileTest : public testing::Test {
+protected:
+  void SetUp() override {
+    path_ = std::filesystem::temp_directory_path() /
+            testing::UnitTest::GetInstance()->current_test_info()->name();
+  }
+
+  void TearDown() override {
+    std::filesystem::remove(path_);
+  }
+
+  std::filesystem::path path_;
+};
+
+} // namespace
+
+// NOLINTNEXTLINE
+TEST_F(SceneFileTest, RoundTripPreservesHandlesAndTransforms) {
+  std::vector<Entity> entities;
+  for (int index = 0; index < 10; ++index) {
+    TransformDescriptor transform_desc{
+        .position = {static_cast<float>(index), 1.F, 2.F},
+        .scale = {2.F, 2.F, 2.F},
+    };
+    EntityDescriptor entity_desc{.transform = &transform_desc};
+    entities.push_back(CreateGameEntity(entity_desc));
+    ASSERT_TRUE(entities.back().IsValid());
+  }
+  // Leave a hole in the tables, so that the freelist is saved as well.
+  const auto removed = entities[3];
+  ASSERT_EQ(RemoveGameEntity(removed), 1);
+  entities.erase(entities.begin() + 3);
+
+  ASSERT_EQ(scene::Save(path_), scene::Status::kSuccess);
+
+  // Change the world after saving, loading must replace it all.
+  TransformDescriptor transform_desc{};
+  EntityDescriptor entity_desc{.transform = &transform_desc};
+  const auto extra = CreateGameEntity(entity_desc);
+  ASSERT_EQ(RemoveGameEntity(entities.front()), 1);
+
+  ASSERT_EQ(scene::Load(path_), scene::Status::kSuccess);
+
+  for (const auto &entity : entities) {
+    const auto transform = entity.GetTransform();
+    ASSERT_TRUE(transform.IsValid());
+    ASSERT_EQ(transform.GetScale(), glm::vec3(2.F, 2.F, 2.F));
+  }
+  ASSERT_EQ(entities[3].GetTransform().GetPosition(), glm::vec3(4.F, 1.F, 2.F));
+  ASSERT_FALSE(Transform(removed.GetTransformId()).IsValid());
+  ASSERT_FALSE(Transform(extra.GetTransformId()).IsValid());
+
+  // Entities created after loading reuse the hole left in the saved world.
+  const auto reused = CreateGameEntity(entity_desc);
+  ASSERT_EQ(reused.GetEntityId().Index(), removed.GetEntityId().Index());
+  ASSERT_NE(reused.GetEntityId(), removed.GetEntityId());
+}
+
+// NOLINTNEXTLINE
+TEST_F(SceneFileTest, SaveAsyncProducesSameFile) {
+  TransformDescriptor transform_desc{};
+  EntityDescriptor entity_desc{.transform = &transform_desc};
+  CreateGameEntity(entity_desc);
+
+  const auto sync_path = path_;
+  ASSERT_EQ(scene::Save(sync_path), scene::Status::kSuccess);
+  path_ += ".async";
+  ASSERT_EQ(scene::SaveAsync(path_).get(), scene::Status::kSuccess);
+
+  const auto read_all = [](const std::filesystem::path &path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(file), {});
+  };
+  ASSERT_EQ(read_all(sync_path), read_all(path_));
+  std::filesystem::remove(sync_path);
+}
+
+// NOLINTNEXTLINE
+TEST_F(SceneFileTest, LoadRejectsInvalidFiles) {
+  ASSERT_EQ(scene::Load(path_), scene::Status::kCannotOpenFile);
+
+  {
+    std::ofstream file(path_, std::ios::binary);
+    file << "not a scene file";
+  }
+  ASSERT_EQ(scene::Load(path_), scene::Status::kNotASceneFile);
+
+  {
+    const scene::FileHeader header{.column_count = 100};
+    std::ofstream file(path_, std::ios::binary);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  }
+  ASSERT_EQ(scene::Load(path_), scene::Status::kCorruptedFile);
+
+  {
+    const scene::FileHeader header{.version = scene::kFileVersion + 1};
+    std::ofstream file(path_, std::ios::binary);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  }
+  ASSERT_EQ(scene::Load(path_), scene::Status::kUnsupportedVersion);
+
+  {
+    const scene::FileHeader header{.version = 0};
+    std::ofstream file(path_, std::ios::binary);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  }
+  ASSERT_EQ(scene::Load(path_), scene::Status::kUnsupportedVersion);
+}
@@ -4,8 +4,12 @@
 // SPDX-License-Identifier: BSD-3-Clause
 //===----------------------------------------------------------------------===//
 
+#include <cassert>
+#include <vector>
+
 #include "oxygen/base/resource_table.h"
 
+#include "oxygen/world/detail/tables.h"
 #include "transform.h"
 
 namespace {
@@ -18,8 +22,68 @@ oxygen::ResourceTable<glm::quat> rotations(
     oxygen::world::resources::kTransform, 256);
 oxygen::ResourceTable<glm::vec3> scales(
     oxygen::world::resources::kTransform, 256);
+
+using oxygen::world::transform::Delta;
+using oxygen::world::transform::Field;
+
+using oxygen::world::transform::kMaxFrameDeltas;
+
+// Deltas being recorded for the current frame, and deltas published at the end
+// of the previous frame, with whether changes were not recorded because the
+// frame reached the limit. Not synchronized, like the tables they track.
+std::vector<Delta> recording_deltas;
+std::vector<Delta> published_deltas;
+bool recording_overflowed{false};
+bool published_overflowed{false};
+
+auto HasRoomForDelta() -> bool {
+  if (recording_deltas.size() < kMaxFrameDeltas) {
+    return true;
+  }
+  recording_overflowed = true;
+  return false;
+}
+
+void RecordDelta(const oxygen::ResourceHandle &handle, const Field field,
+    const glm::vec3 &value) {
+  if (!HasRoomForDelta()) {
+    return;
+  }
+  recording_deltas.push_back({
+      .handle = handle.Handle(),
+      .value = {value.x, value.y, value.z, 0.F},
+      .field = field,
+  });
+}
+
+void RecordDelta(const oxygen::ResourceHandle &handle, const glm::quat &value) {
+  if (!HasRoomForDelta()) {
+    return;
+  }
+  recording_deltas.push_back({
+      .handle = handle.Handle(),
+      .value = {value.x, value.y, value.z, value.w},
+      .field = Field::kRotation,
+  });
+}
 } // namespace
 
+auto oxygen::world::detail::TransformTable() -> ResourceTable<Transform> & {
+  return transforms;
+}
+
+auto oxygen::world::detail::PositionTable() -> ResourceTable<glm::vec3> & {
+  return positions;
+}
+
+auto oxygen::world::detail::RotationTable() -> ResourceTable<glm::quat> & {
+  return rotations;
+}
+
+auto oxygen::world::detail::ScaleTable() -> ResourceTable<glm::vec3> & {
+  return scales;
+}
+
 auto oxygen::world::transform::CreateTransform(
     TransformDescriptor &transform_desc,
     const EntityId &entity_id) -> Transform {
@@ -70,6 +134,83 @@ auto oxygen::world::Transform::GetScale() const noexcept -> glm::vec3 {
   return scales.ItemAt(GetId());
 }
 
+void oxygen::world::Transform::SetPosition(const glm::vec3 &position) const {
+  assert(IsValid());
+  auto &current = positions.ItemAt(GetId());
+  if (current != position) {
+    current = position;
+    RecordDelta(GetId(), Field::kPosition, position);
+  }
+}
+
+void oxygen::world::Transform::SetRotation(const glm::quat &rotation) const {
+  assert(IsValid());
+  auto &current = rotations.ItemAt(GetId());
+  if (current != rotation) {
+    current = rotation;
+    RecordDelta(GetId(), rotation);
+  }
+}
+
+void oxygen::world::Transform::SetScale(const glm::vec3 &scale) const {
+  assert(IsValid());
+  auto &current = scales.ItemAt(GetId());
+  if (current != scale) {
+    current = scale;
+    RecordDelta(GetId(), Field::kScale, scale);
+  }
+}
+
+void oxygen::world::transform::SetPositions(
+    std::span<const Transform> transforms, std::span<const glm::vec3> values) {
+  assert(transforms.size() == values.size());
+  if (transforms.size() != values.size()) {
+    return;
+  }
+  for (size_t index = 0; index < transforms.size(); ++index) {
+    transforms[index].SetPosition(values[index]);
+  }
+}
+
+void oxygen::world::transform::SetRotations(
+    std::span<const Transform> transforms, std::span<const glm::quat> values) {
+  assert(transforms.size() == values.size());
+  if (transforms.size() != values.size()) {
+    return;
+  }
+  for (size_t index = 0; index < transforms.size(); ++index) {
+    transforms[index].SetRotation(values[index]);
+  }
+}
+
+void oxygen::world::transform::SetScales(
+    std::span<const Transform> transforms, std::span<const glm::vec3> values) {
+  assert(transforms.size() == values.size());
+  if (transforms.size() != values.size()) {
+    return;
+  }
+  for (size_t index = 0; index < transforms.size(); ++index) {
+    transforms[index].SetScale(values[index]);
+  }
+}
+
+void oxygen::world::transform::EndFrame() {
+  // Swapping keeps the capacity of both buffers, so that recording does not
+  // allocate once the buffers have grown to the typical frame size.
+  published_deltas.swap(recording_deltas);
+  recording_deltas.clear();
+  published_overflowed = recording_overflowed;
+  recording_overflowed = false;
+}
+
+auto oxygen::world::transform::FrameDeltas() -> std::span<const Delta> {
+  return published_deltas;
+}
+
+auto oxygen::world::transform::FrameDeltasOverflowed() -> bool {
+  return published_overflowed;
+}
+
 auto oxygen::world::Transform::IsValid() const noexcept -> bool {
   return Resource::IsValid() && transforms.Contains(GetId());
 }
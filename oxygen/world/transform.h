@@ -6,6 +6,11 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
 #include "glm/glm.hpp"
 #include "glm/gtc/quaternion.hpp"
 #include "oxygen/base/resource.h"
@@ -24,6 +29,64 @@ struct Descriptor {
 auto CreateTransform(TransformDescriptor &transform_desc,
     const EntityId &entity_id) -> Transform;
 auto RemoveTransform(const Transform &transform) -> size_t;
+
+// Batch variants of the `Transform` setters. Both spans must have the same
+// size, nothing is set otherwise; each transform gets the value at the same
+// position.
+void SetPositions(
+    std::span<const Transform> transforms, std::span<const glm::vec3> values);
+void SetRotations(
+    std::span<const Transform> transforms, std::span<const glm::quat> values);
+void SetScales(
+    std::span<const Transform> transforms, std::span<const glm::vec3> values);
+
+/*
+Transform delta stream.
+
+Every change made through the setters appends a compact record to the delta
+buffer of the current frame, so that consumers such as the editor bridge or
+the network replicator only process what changed instead of the whole
+transform set. Setting a field to its current value is not recorded.
+
+Records are appended in the order of the changes, and a field may appear more
+than once in the same frame; applying them in order gives the final state.
+Values are stored as raw floats (x, y, z for vectors, and x, y, z, w for
+rotations), leaving the choice of quantization to each consumer.
+
+The buffer is double buffered: `EndFrame()` publishes the records of the frame
+that just ended, which remain available through `FrameDeltas()` until the next
+call, and starts recording the new frame from an empty buffer. The engine does
+not own the world, the owner of the world must call `EndFrame()` once per
+frame, even when nobody consumes the deltas.
+
+A frame records at most `kMaxFrameDeltas` changes, so that the buffer does not
+grow without bound when `EndFrame()` is not called. The changes past that are
+not recorded, and `FrameDeltasOverflowed()` tells the consumers that the deltas
+of the frame are incomplete and that they must read the whole transform set.
+
+The transform tables and the delta buffers are not synchronized: the setters,
+`EndFrame()` and `FrameDeltas()` must be called from one thread at a time, the
+one running the simulation of the frame, and never from parallel jobs.
+*/
+
+enum class Field : uint8_t {
+  kPosition = 0,
+  kRotation = 1,
+  kScale = 2,
+};
+
+struct Delta {
+  ResourceHandle::HandleT handle;
+  std::array<float, 4> value;
+  Field field;
+};
+
+constexpr size_t kMaxFrameDeltas{size_t{1} << 20U};
+
+void EndFrame();
+[[nodiscard]] auto FrameDeltas() -> std::span<const Delta>;
+[[nodiscard]] auto FrameDeltasOverflowed() -> bool;
+
 } // namespace transform
 
 class Transform : public Resource<resources::kTransform> {
@@ -51,6 +114,10 @@ public:
   [[nodiscard]] auto GetPosition() const noexcept -> glm::vec3;
   [[nodiscard]] auto GetRotation() const noexcept -> glm::quat;
   [[nodiscard]] auto GetScale() const noexcept -> glm::vec3;
+
+  void SetPosition(const glm::vec3 &position) const;
+  void SetRotation(const glm::quat &rotation) const;
+  void SetScale(const glm::vec3 &scale) const;
 };
 
 } // namespace oxygen::world